@@ -0,0 +1,293 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Compares two JSON reports written by the benchmark harness
+// Usage: compare <baseline.json> <current.json> [threshold in percent, default 5]
+//
+// A benchmark is flagged as a regression when its median time per operation grew by more
+// than the threshold and by more than the combined median absolute deviation of both runs.
+// The exit code is 1 if any regression was found.
+
+#include <boost/charconv/from_chars.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct entry
+{
+    double median_ns = 0;
+    double mad_ns = 0;
+};
+
+// Results in the order in which they were run
+using report = std::vector<std::pair<std::string, entry>>;
+
+static entry const* find( report const& r, std::string const& name )
+{
+    for( auto const& x: r )
+    {
+        if( x.first == name ) return &x.second;
+    }
+
+    return nullptr;
+}
+
+// Reader for the subset of JSON that the harness writes
+class reader
+{
+public:
+
+    explicit reader( std::string const& text ): p_( text.data() ), last_( text.data() + text.size() )
+    {
+    }
+
+    bool parse( report& out )
+    {
+        return value( out ) && ( skip_ws(), p_ == last_ );
+    }
+
+private:
+
+    char const* p_;
+    char const* last_;
+
+    void skip_ws()
+    {
+        while( p_ != last_ && ( *p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r' ) ) ++p_;
+    }
+
+    bool consume( char c )
+    {
+        skip_ws();
+        if( p_ == last_ || *p_ != c ) return false;
+        ++p_;
+        return true;
+    }
+
+    bool string( std::string& s )
+    {
+        if( !consume( '"' ) ) return false;
+
+        s.clear();
+
+        while( p_ != last_ && *p_ != '"' )
+        {
+            if( *p_ == '\\' )
+            {
+                if( ++p_ == last_ ) return false;
+
+                if( *p_ == 'u' )
+                {
+                    unsigned code = 0;
+                    if( last_ - p_ < 5 || !boost::charconv::from_chars( p_ + 1, p_ + 5, code, 16 ) ) return false;
+                    s += static_cast<char>( code );
+                    p_ += 5;
+                    continue;
+                }
+            }
+
+            s += *p_++;
+        }
+
+        return consume( '"' );
+    }
+
+    bool number( double& d )
+    {
+        skip_ws();
+        auto r = boost::charconv::from_chars( p_, last_, d );
+        if( !r ) return false;
+        p_ = r.ptr;
+        return true;
+    }
+
+    bool value( report& out )
+    {
+        skip_ws();
+        if( p_ == last_ ) return false;
+
+        if( *p_ == '{' ) return object( out );
+        if( *p_ == '[' ) return array( out );
+
+        if( *p_ == '"' )
+        {
+            std::string s;
+            return string( s );
+        }
+
+        for( char const* literal: { "true", "false", "null" } )
+        {
+            std::size_t const n = std::strlen( literal );
+
+            if( static_cast<std::size_t>( last_ - p_ ) >= n && std::memcmp( p_, literal, n ) == 0 )
+            {
+                p_ += n;
+                return true;
+            }
+        }
+
+        double d;
+        return number( d );
+    }
+
+    bool array( report& out )
+    {
+        if( !consume( '[' ) ) return false;
+        if( consume( ']' ) ) return true;
+
+        do
+        {
+            if( !value( out ) ) return false;
+        }
+        while( consume( ',' ) );
+
+        return consume( ']' );
+    }
+
+    // An object with "name" and "median_ns" members is a benchmark result
+    bool object( report& out )
+    {
+        if( !consume( '{' ) ) return false;
+        if( consume( '}' ) ) return true;
+
+        std::string name;
+        entry e;
+        bool has_median = false;
+
+        do
+        {
+            std::string key;
+            if( !string( key ) || !consume( ':' ) ) return false;
+
+            skip_ws();
+
+            if( key == "name" && p_ != last_ && *p_ == '"' )
+            {
+                if( !string( name ) ) return false;
+            }
+            else if( key == "median_ns" )
+            {
+                if( !number( e.median_ns ) ) return false;
+                has_median = true;
+            }
+            else if( key == "mad_ns" )
+            {
+                if( !number( e.mad_ns ) ) return false;
+            }
+            else if( !value( out ) )
+            {
+                return false;
+            }
+        }
+        while( consume( ',' ) );
+
+        if( !name.empty() && has_median )
+        {
+            out.emplace_back( name, e );
+        }
+
+        return consume( '}' );
+    }
+};
+
+static bool load( char const* path, report& out )
+{
+    std::ifstream file( path, std::ios::binary );
+
+    if( !file )
+    {
+        std::fprintf( stderr, "Unable to open %s\n", path );
+        return false;
+    }
+
+    std::ostringstream text;
+    text << file.rdbuf();
+
+    if( !reader( text.str() ).parse( out ) )
+    {
+        std::fprintf( stderr, "%s is not a benchmark report\n", path );
+        return false;
+    }
+
+    return true;
+}
+
+int main( int argc, char** argv )
+{
+    if( argc != 3 && argc != 4 )
+    {
+        std::fprintf( stderr, "Usage: %s <baseline.json> <current.json> [threshold in percent, default 5]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    double threshold = 5;
+
+    if( argc == 4 )
+    {
+        auto r = boost::charconv::from_chars( argv[ 3 ], argv[ 3 ] + std::strlen( argv[ 3 ] ), threshold );
+
+        if( !r || *r.ptr != '\0' || threshold < 0 )
+        {
+            std::fprintf( stderr, "Invalid threshold: %s\n", argv[ 3 ] );
+            return 2;
+        }
+    }
+
+    report baseline, current;
+
+    if( !load( argv[ 1 ], baseline ) || !load( argv[ 2 ], current ) )
+    {
+        return 2;
+    }
+
+    std::size_t regressions = 0;
+
+    std::printf( "%-60s %12s %12s %9s\n", "benchmark", "baseline ns", "current ns", "change" );
+
+    for( auto const& c: current )
+    {
+        entry const* b = find( baseline, c.first );
+
+        if( b == nullptr )
+        {
+            std::printf( "%-60s %12s %12.2f %9s\n", c.first.c_str(), "-", c.second.median_ns, "new" );
+            continue;
+        }
+
+        double const base = b->median_ns;
+        double const now = c.second.median_ns;
+        double const change = base > 0? ( now - base ) / base * 100: 0;
+
+        char const* flag = "";
+
+        if( change > threshold && now - base > b->mad_ns + c.second.mad_ns )
+        {
+            flag = "  REGRESSION";
+            ++regressions;
+        }
+        else if( -change > threshold && base - now > b->mad_ns + c.second.mad_ns )
+        {
+            flag = "  improved";
+        }
+
+        std::printf( "%-60s %12.2f %12.2f %+8.1f%%%s\n", c.first.c_str(), base, now, change, flag );
+    }
+
+    for( auto const& b: baseline )
+    {
+        if( find( current, b.first ) == nullptr )
+        {
+            std::printf( "%-60s %12.2f %12s %9s\n", b.first.c_str(), b.second.median_ns, "-", "removed" );
+        }
+    }
+
+    std::printf( "\n%zu regression(s) above %.1f%%\n", regressions, threshold );
+
+    return regressions == 0? 0: 1;
+}
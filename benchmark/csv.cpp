@@ -0,0 +1,184 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Decodes a CSV table of numeric columns by splitting it into fields and calling from_chars
+// on each one, and with parse_csv. The table has an int64, a text, a double, a float and a
+// uint64 column; the text column is skipped. Results are in MB/s of CSV text.
+
+#include <boost/charconv/csv.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+constexpr std::size_t N = 200'000;
+
+struct table
+{
+    std::vector<std::int64_t> a;
+    std::vector<double> b;
+    std::vector<float> c;
+    std::vector<std::uint64_t> d;
+
+    void resize( std::size_t n )
+    {
+        a.resize( n ); b.resize( n ); c.resize( n ); d.resize( n );
+    }
+};
+
+static std::string make_csv()
+{
+    boost::detail::splitmix64 rng;
+    std::string text = "id,name,price,weight,count\n";
+
+    for( std::size_t i = 0; i < N; )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( !std::isfinite( x ) ) continue;
+
+        char buffer[ 128 ];
+        char* p = buffer;
+
+        p = boost::charconv::to_chars( p, buffer + sizeof( buffer ), static_cast<std::int64_t>( rng() ) >> ( i % 48 ) ).ptr;
+        std::memcpy( p, i % 4 == 0? ",\"item, large\",": ",item,", i % 4 == 0? 15: 6 );
+        p += i % 4 == 0? 15: 6;
+        p = boost::charconv::to_chars( p, buffer + sizeof( buffer ), x ).ptr;
+        *p++ = ',';
+        p = boost::charconv::to_chars( p, buffer + sizeof( buffer ), static_cast<float>( rng() % 100000 ) / 128 ).ptr;
+        *p++ = ',';
+        p = boost::charconv::to_chars( p, buffer + sizeof( buffer ), rng() >> ( i % 64 ) ).ptr;
+        *p++ = '\n';
+
+        text.append( buffer, p );
+        ++i;
+    }
+
+    return text;
+}
+
+// What a CSV reader without a schema typically does: a std::string per line and per field
+static std::size_t getline_split( std::string const& text, table& t )
+{
+    std::istringstream is( text );
+    std::string line, field;
+    std::getline( is, line );
+
+    std::size_t row = 0;
+
+    while( std::getline( is, line ) )
+    {
+        std::vector<std::string> fields;
+
+        // The quoted field of the benchmark table has one delimiter in it
+        std::istringstream ls( line );
+        while( std::getline( ls, field, ',' ) )
+        {
+            if( !field.empty() && field[ 0 ] == '"' )
+            {
+                std::string rest;
+                std::getline( ls, rest, ',' );
+                field += ',' + rest;
+            }
+
+            fields.push_back( field );
+        }
+
+        if( fields.size() != 5 ) return 0;
+
+        boost::charconv::from_chars( fields[ 0 ].data(), fields[ 0 ].data() + fields[ 0 ].size(), t.a[ row ] );
+        boost::charconv::from_chars( fields[ 2 ].data(), fields[ 2 ].data() + fields[ 2 ].size(), t.b[ row ] );
+        boost::charconv::from_chars( fields[ 3 ].data(), fields[ 3 ].data() + fields[ 3 ].size(), t.c[ row ] );
+        boost::charconv::from_chars( fields[ 4 ].data(), fields[ 4 ].data() + fields[ 4 ].size(), t.d[ row ] );
+        ++row;
+    }
+
+    return text.size();
+}
+
+// Splits in place with memchr, one from_chars call per field
+static std::size_t memchr_split( std::string const& text, table& t )
+{
+    char const* p = text.data();
+    char const* const last = text.data() + text.size();
+
+    p = static_cast<char const*>( std::memchr( p, '\n', static_cast<std::size_t>( last - p ) ) ) + 1;
+
+    for( std::size_t row = 0; p != last; ++row )
+    {
+        char const* eol = static_cast<char const*>( std::memchr( p, '\n', static_cast<std::size_t>( last - p ) ) );
+
+        char const* fields[ 6 ];
+        std::size_t n = 0;
+
+        fields[ n++ ] = p;
+
+        for( char const* q = p; q != eol && n < 5; ++q )
+        {
+            if( *q == '"' )
+            {
+                q = static_cast<char const*>( std::memchr( q + 1, '"', static_cast<std::size_t>( eol - q - 1 ) ) );
+            }
+            else if( *q == ',' )
+            {
+                fields[ n++ ] = q + 1;
+            }
+        }
+
+        if( n != 5 ) return 0;
+        fields[ 5 ] = eol + 1;
+
+        boost::charconv::from_chars( fields[ 0 ], fields[ 1 ] - 1, t.a[ row ] );
+        boost::charconv::from_chars( fields[ 2 ], fields[ 3 ] - 1, t.b[ row ] );
+        boost::charconv::from_chars( fields[ 3 ], fields[ 4 ] - 1, t.c[ row ] );
+        boost::charconv::from_chars( fields[ 4 ], fields[ 5 ] - 1, t.d[ row ] );
+
+        p = eol + 1;
+    }
+
+    return text.size();
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    std::string const text = make_csv();
+
+    table expected, t;
+    expected.resize( N );
+    t.resize( N );
+
+    boost::charconv::csv_options options;
+    options.header = true;
+
+    auto parse = [&]( table& out ){
+
+        boost::charconv::csv_column const columns[] = { out.a.data(), nullptr, out.b.data(), out.c.data(), out.d.data() };
+        return boost::charconv::parse_csv( text.data(), text.data() + text.size(), columns, N, options );
+    };
+
+    if( !parse( expected ) || memchr_split( text, t ) == 0 || t.b != expected.b || t.d != expected.d )
+    {
+        std::fprintf( stderr, "The methods do not agree\n" );
+        return 1;
+    }
+
+    h.run( "std::getline split + from_chars", N, [&]{ return getline_split( text, t ); } );
+    h.run( "memchr split + from_chars", N, [&]{ return memchr_split( text, t ); } );
+    h.run( "parse_csv", N, [&]{ return parse( t ).rows == N? text.size(): 0; } );
+
+    return h.finish();
+}
@@ -0,0 +1,162 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Writes a table with an int64, a double, a float and a uint64 column as CSV to a file,
+// with std::ofstream, with a to_chars call and an fwrite per field, and with csv_writer.
+// Usage: csv_writer [harness options] [file]
+//
+// Without a file the table is written to /dev/null, so the results do not include the cost
+// of the disk. Results are in MB/s of CSV text.
+
+#include <boost/charconv/csv.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
+constexpr std::size_t N = 200'000;
+
+struct table
+{
+    std::vector<std::int64_t> a;
+    std::vector<double> b;
+    std::vector<float> c;
+    std::vector<std::uint64_t> d;
+};
+
+static table make_table()
+{
+    boost::detail::splitmix64 rng;
+    table t;
+
+    for( std::size_t i = 0; i < N; )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( !std::isfinite( x ) ) continue;
+
+        t.a.push_back( static_cast<std::int64_t>( rng() ) >> ( i % 48 ) );
+        t.b.push_back( x );
+        t.c.push_back( static_cast<float>( rng() % 100000 ) / 128 );
+        t.d.push_back( rng() >> ( i % 64 ) );
+        ++i;
+    }
+
+    return t;
+}
+
+static bool ofstream_write( std::string const& path, table const& t )
+{
+    std::ofstream os( path );
+    os.precision( std::numeric_limits<double>::max_digits10 );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        os << t.a[ i ] << ',' << t.b[ i ] << ',' << t.c[ i ] << ',' << t.d[ i ] << '\n';
+    }
+
+    return os.good();
+}
+
+template<class T> static std::size_t write_field( std::FILE* file, T value, char delimiter )
+{
+    char buffer[ 32 ];
+    auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), value );
+    *r.ptr++ = delimiter;
+
+    return std::fwrite( buffer, 1, static_cast<std::size_t>( r.ptr - buffer ), file );
+}
+
+static std::size_t fwrite_per_field( std::string const& path, table const& t )
+{
+    std::FILE* file = std::fopen( path.c_str(), "wb" );
+    if( file == nullptr ) return 0;
+
+    std::size_t bytes = 0;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        bytes += write_field( file, t.a[ i ], ',' );
+        bytes += write_field( file, t.b[ i ], ',' );
+        bytes += write_field( file, t.c[ i ], ',' );
+        bytes += write_field( file, t.d[ i ], '\n' );
+    }
+
+    std::fclose( file );
+    return bytes;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+static bool csv_writer_write( std::string const& path, table const& t )
+{
+    int fd = ::open( path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+    if( fd < 0 ) return false;
+
+    bool ok;
+
+    {
+        boost::charconv::csv_writer w( fd );
+        boost::charconv::const_csv_column const columns[] = { t.a.data(), t.b.data(), t.c.data(), t.d.data() };
+
+        ok = w.write_rows( columns, N ) == std::errc() && w.flush() == std::errc();
+    }
+
+    ::close( fd );
+    return ok;
+}
+
+#endif
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( h.args().size() > 1 )
+    {
+        std::fprintf( stderr, "Usage: %s [harness options] [file]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    std::string const path = h.args().empty()? "/dev/null": h.args()[ 0 ];
+
+    table const t = make_table();
+
+    // The size of the text as csv_writer formats it, which the MB/s of every method is based on
+    std::size_t bytes = 0;
+
+    {
+        boost::charconv::csv_writer w;
+        boost::charconv::const_csv_column const columns[] = { t.a.data(), t.b.data(), t.c.data(), t.d.data() };
+        w.write_rows( columns, N );
+        bytes = w.size();
+    }
+
+    h.run( "std::ofstream", N, [&]{ return ofstream_write( path, t )? bytes: 0; } );
+    h.run( "to_chars + fwrite per field", N, [&]{ return fwrite_per_field( path, t ); } );
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    h.run( "csv_writer", N, [&]{ return csv_writer_write( path, t )? bytes: 0; } );
+
+#endif
+
+    return h.finish();
+}
@@ -0,0 +1,316 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures floating point parsing on datasets with one number per line.
+// Usage: from_chars_datasets [harness options] [file...]
+//
+// Without files it measures generated datasets modeled on the usual real world corpora:
+//   canada     coordinates stored as doubles and printed with 17 digits (canada.json)
+//   mesh       short decimals with 3 or 4 significant digits (mesh.txt)
+//   marine_ik  shortest representation of doubles of moderate magnitude (marine_ik.json)
+//   prices     amounts with two decimals
+//   integers   integers stored as doubles
+// The generators only use splitmix64 and std::to_chars, so the datasets are the same on every platform.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "harness.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+constexpr unsigned N = 100'000;
+
+struct dataset
+{
+    std::string name;
+
+    // The numbers separated by '\n', followed by a null terminator for strtod
+    std::string text;
+    std::size_t count = 0;
+};
+
+static double uniform( boost::detail::splitmix64& rng )
+{
+    return static_cast<double>( rng() >> 11 ) * 0x1.0p-53;
+}
+
+// The text is produced by std::to_chars so that it does not depend on the library being measured
+static void append( dataset& d, double x, std::chars_format fmt = std::chars_format::fixed, int precision = -1 )
+{
+    char buffer[ 64 ];
+    auto r = precision == -1? std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
+                              std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
+
+    d.text.append( buffer, r.ptr );
+    d.text += '\n';
+    ++d.count;
+}
+
+static dataset make_canada()
+{
+    dataset d;
+    d.name = "canada";
+    boost::detail::splitmix64 rng( 1 );
+
+    double lon = -100, lat = 60;
+
+    for( unsigned i = 0; i < N / 2; ++i )
+    {
+        // A random walk along a border, at a resolution of 1e-6 degrees
+        lon = std::round( ( lon + ( uniform( rng ) - 0.5 ) * 0.01 ) * 1e6 ) / 1e6;
+        lat = std::round( ( lat + ( uniform( rng ) - 0.5 ) * 0.01 ) * 1e6 ) / 1e6;
+
+        append( d, lon, std::chars_format::general, 17 );
+        append( d, lat, std::chars_format::general, 17 );
+    }
+
+    return d;
+}
+
+static dataset make_mesh()
+{
+    dataset d;
+    d.name = "mesh";
+    boost::detail::splitmix64 rng( 2 );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        double const scale = ( rng() & 1 )? 1000: 100;
+        append( d, std::round( ( uniform( rng ) * 2 - 1 ) * 4 * scale ) / scale );
+    }
+
+    return d;
+}
+
+static dataset make_marine_ik()
+{
+    dataset d;
+    d.name = "marine_ik";
+    boost::detail::splitmix64 rng( 3 );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        append( d, std::ldexp( uniform( rng ) * 2 - 1, static_cast<int>( rng() % 4 ) ) );
+    }
+
+    return d;
+}
+
+static dataset make_prices()
+{
+    dataset d;
+    d.name = "prices";
+    boost::detail::splitmix64 rng( 4 );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        // Log-uniform between 0.01 and 100000.00
+        auto const cents = static_cast<std::uint64_t>( std::pow( 10.0, uniform( rng ) * 7 ) );
+
+        char buffer[ 32 ];
+        auto r = std::to_chars( buffer, buffer + sizeof( buffer ), cents / 100 );
+        *r.ptr++ = '.';
+        *r.ptr++ = static_cast<char>( '0' + cents / 10 % 10 );
+        *r.ptr++ = static_cast<char>( '0' + cents % 10 );
+
+        d.text.append( buffer, r.ptr );
+        d.text += '\n';
+        ++d.count;
+    }
+
+    return d;
+}
+
+static dataset make_integers()
+{
+    dataset d;
+    d.name = "integers";
+    boost::detail::splitmix64 rng( 5 );
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        // Uniformly distributed number of bits, so that short integers are as common as long ones
+        unsigned const bits = 1 + static_cast<unsigned>( rng() % 53 );
+        append( d, static_cast<double>( rng() >> ( 64 - bits ) ) );
+    }
+
+    return d;
+}
+
+// Keeps the non-empty lines, without surrounding whitespace
+static bool load( std::string const& path, dataset& d )
+{
+    std::ifstream file( path, std::ios::binary );
+    if( !file ) return false;
+
+    std::size_t const slash = path.find_last_of( "/\\" );
+    d.name = path.substr( slash == std::string::npos? 0: slash + 1 );
+
+    std::string line;
+
+    while( std::getline( file, line ) )
+    {
+        std::size_t const first = line.find_first_not_of( " \t\r" );
+        if( first == std::string::npos ) continue;
+
+        std::size_t const last = line.find_last_not_of( " \t\r" );
+
+        d.text.append( line, first, last - first + 1 );
+        d.text += '\n';
+        ++d.count;
+    }
+
+    return true;
+}
+
+// Every line must be a number that all three functions parse the same way
+static bool validate( dataset const& d )
+{
+    char const* p = d.text.data();
+    char const* const last = p + d.text.size();
+
+    std::size_t mismatches = 0;
+
+    for( std::size_t i = 0; i < d.count; ++i )
+    {
+        char const* eol = static_cast<char const*>( std::memchr( p, '\n', static_cast<std::size_t>( last - p ) ) );
+
+        double x1 = 0, x2 = 0;
+        auto r1 = boost::charconv::from_chars( p, eol, x1 );
+        auto r2 = std::from_chars( p, eol, x2 );
+        double const x3 = std::strtod( p, nullptr );
+
+        if( !r1 || r1.ptr != eol )
+        {
+            std::fprintf( stderr, "%s: line %zu is not a number: %.*s\n", d.name.c_str(), i + 1, static_cast<int>( eol - p ), p );
+            return false;
+        }
+
+        if( r2.ptr != eol || std::memcmp( &x1, &x2, sizeof( x1 ) ) != 0 || std::memcmp( &x1, &x3, sizeof( x1 ) ) != 0 )
+        {
+            ++mismatches;
+        }
+
+        p = eol + 1;
+    }
+
+    if( mismatches != 0 )
+    {
+        std::fprintf( stderr, "%s: %zu numbers are not parsed identically by the three functions\n", d.name.c_str(), mismatches );
+    }
+
+    return true;
+}
+
+static BOOST_NOINLINE void test_strtod( bench::harness& h, dataset const& d )
+{
+    h.run( d.name + ", std::strtod", d.count, [&]{
+
+        char const* p = d.text.c_str();
+        double s = 0;
+
+        for( std::size_t i = 0; i < d.count; ++i )
+        {
+            char* end = nullptr;
+            s += std::strtod( p, &end );
+            p = end + 1;
+        }
+
+        bench::do_not_optimize( s );
+        return d.text.size();
+    });
+}
+
+static BOOST_NOINLINE void test_std_from_chars( bench::harness& h, dataset const& d )
+{
+    h.run( d.name + ", std::from_chars", d.count, [&]{
+
+        char const* p = d.text.data();
+        char const* const last = p + d.text.size();
+        double s = 0;
+
+        for( std::size_t i = 0; i < d.count; ++i )
+        {
+            double x;
+            p = std::from_chars( p, last, x ).ptr + 1;
+            s += x;
+        }
+
+        bench::do_not_optimize( s );
+        return d.text.size();
+    });
+}
+
+static BOOST_NOINLINE void test_boost_from_chars( bench::harness& h, dataset const& d )
+{
+    h.run( d.name + ", boost::charconv::from_chars", d.count, [&]{
+
+        char const* p = d.text.data();
+        char const* const last = p + d.text.size();
+        double s = 0;
+
+        for( std::size_t i = 0; i < d.count; ++i )
+        {
+            double x;
+            p = boost::charconv::from_chars( p, last, x ).ptr + 1;
+            s += x;
+        }
+
+        bench::do_not_optimize( s );
+        return d.text.size();
+    });
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    std::vector<dataset> datasets;
+
+    if( h.args().empty() )
+    {
+        datasets.push_back( make_canada() );
+        datasets.push_back( make_mesh() );
+        datasets.push_back( make_marine_ik() );
+        datasets.push_back( make_prices() );
+        datasets.push_back( make_integers() );
+    }
+
+    for( auto const& path: h.args() )
+    {
+        dataset d;
+
+        if( !load( path, d ) )
+        {
+            std::fprintf( stderr, "Unable to open %s\n", path.c_str() );
+            return 1;
+        }
+
+        datasets.push_back( std::move( d ) );
+    }
+
+    for( auto const& d: datasets )
+    {
+        if( d.count == 0 || !validate( d ) ) return 1;
+
+        std::printf( "%s: %zu numbers, %.1f bytes/number\n", d.name.c_str(), d.count, static_cast<double>( d.text.size() ) / static_cast<double>( d.count ) );
+
+        test_strtod( h, d );
+        test_std_from_chars( h, d );
+        test_boost_from_chars( h, d );
+
+        std::printf( "\n" );
+    }
+
+    return h.finish();
+}
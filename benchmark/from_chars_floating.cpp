@@ -8,16 +8,18 @@
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/config.hpp>
+#include "harness.hpp"
 #include <type_traits>
-#include <chrono>
+#include <cmath>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 #include <charconv>
 #include <random>
 
 constexpr unsigned N = 2'000'000;
-constexpr int K = 10;
 
 template<class T> static BOOST_NOINLINE void init_input_data( std::vector<std::string>& data, bool general )
 {
@@ -81,201 +83,136 @@ template<class T> static BOOST_NOINLINE void init_input_data_uint64( std::vector
     }
 }
 
-using namespace std::chrono_literals;
+template<class T> static T strtox( char const* str, char** end );
 
-template<class T> void test_strtox( std::vector<std::string> const& data, bool general, char const* label );
-
-template<> BOOST_NOINLINE void test_strtox<float>( std::vector<std::string> const& data, bool, char const* label )
+template<> float strtox<float>( char const* str, char** end )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    double s = 0;
-
-    for( int i = 0; i < K; ++i )
-    {
-        for( auto const& x: data )
-        {
-            float y = std::strtof( x.c_str(), nullptr );
-            s = s / 16.0 + y;
-        }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "                std::strtox<float>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return std::strtof( str, end );
 }
 
-template<> BOOST_NOINLINE void test_strtox<double>( std::vector<std::string> const& data, bool, char const* label )
+template<> double strtox<double>( char const* str, char** end )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    double s = 0;
-
-    for( int i = 0; i < K; ++i )
-    {
-        for( auto const& x: data )
-        {
-            double y = std::strtod( x.c_str(), nullptr );
-            s = s / 16.0 + y;
-        }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "                std::strtox<double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return std::strtod( str, end );
 }
 
-template<> BOOST_NOINLINE void test_strtox<long double>( std::vector<std::string> const& data, bool, char const* label )
+template<> long double strtox<long double>( char const* str, char** end )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    long double s = 0;
-
-    for( int i = 0; i < K; ++i )
-    {
-        for( auto const& x: data )
-        {
-            double y = std::strtold( x.c_str(), nullptr );
-            s = s / 16.0L + y;
-        }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "                std::strtox<long double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return std::strtold( str, end );
 }
 
-template<class T> static BOOST_NOINLINE void test_std_from_chars( std::vector<std::string> const& data, bool general, char const* label )
+template<class T> static std::string label( char const* function, char const* format )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    double s = 0;
-
-    for( int i = 0; i < K; ++i )
-    {
-        for( auto const& x: data )
-        {
-            T y;
-            std::from_chars( x.data(), x.data() + x.size(), y, general? std::chars_format::general: std::chars_format::scientific );
-
-            s = s / 16.0 + y;
-        }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::from_chars<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+    return std::string( function ) + "<" + boost::core::type_name<T>() + ">, " + format;
 }
 
-template<> BOOST_NOINLINE void test_std_from_chars<long double>( std::vector<std::string> const& data, bool general, char const* label )
+// The parsed values are folded into s so that the conversions can not be elided
+template<class T> static BOOST_NOINLINE void test_strtox( bench::harness& h, std::vector<std::string> const& data, bool, char const* format )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    h.run( label<T>( "std::strtox", format ), data.size(), [&]{
 
-    long double s = 0;
+        long double s = 0;
+        std::size_t n = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
         for( auto const& x: data )
         {
-            long double y;
-            std::from_chars( x.data(), x.data() + x.size(), y, general? std::chars_format::general: std::chars_format::scientific );
+            char* end = nullptr;
+            T y = strtox<T>( x.c_str(), &end );
 
             s = s / 16.0L + y;
+            n += static_cast<std::size_t>( end - x.c_str() );
         }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
 
-    std::cout << "            std::from_chars<long double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        bench::do_not_optimize( s );
+        return n;
+    });
 }
 
-template<class T> static BOOST_NOINLINE void test_boost_from_chars( std::vector<std::string> const& data, bool general, char const* label )
+template<class T> static BOOST_NOINLINE void test_std_from_chars( bench::harness& h, std::vector<std::string> const& data, bool general, char const* format )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    h.run( label<T>( "std::from_chars", format ), data.size(), [&]{
 
-    double s = 0;
+        long double s = 0;
+        std::size_t n = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
         for( auto const& x: data )
         {
             T y;
-            boost::charconv::from_chars( x.data(), x.data() + x.size(), y, general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific );
+            auto r = std::from_chars( x.data(), x.data() + x.size(), y, general? std::chars_format::general: std::chars_format::scientific );
 
-            s = s / 16.0 + y;
+            s = s / 16.0L + y;
+            n += static_cast<std::size_t>( r.ptr - x.data() );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::from_chars<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        bench::do_not_optimize( s );
+        return n;
+    });
 }
 
-template<>
-BOOST_NOINLINE void test_boost_from_chars<long double>( std::vector<std::string> const& data, bool general, char const* label )
+template<class T> static BOOST_NOINLINE void test_boost_from_chars( bench::harness& h, std::vector<std::string> const& data, bool general, char const* format )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    h.run( label<T>( "boost::charconv::from_chars", format ), data.size(), [&]{
 
-    long double s = 0;
+        long double s = 0;
+        std::size_t n = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
         for( auto const& x: data )
         {
-            long double y;
-            boost::charconv::from_chars( x.data(), x.data() + x.size(), y, general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific );
+            T y;
+            auto r = boost::charconv::from_chars( x.data(), x.data() + x.size(), y, general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific );
 
             s = s / 16.0L + y;
+            n += static_cast<std::size_t>( r.ptr - x.data() );
         }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
 
-    std::cout << "boost::charconv::from_chars<long double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        bench::do_not_optimize( s );
+        return n;
+    });
 }
 
-template<class T> static void test( bool general )
+template<class T> static void test( bench::harness& h, bool general )
 {
     std::vector<std::string> data;
     init_input_data<T>( data, general );
 
-    char const* label = general? "general": "scientific";
+    char const* format = general? "general": "scientific";
 
-    test_strtox<T>( data, general, label );
-    test_std_from_chars<T>( data, general, label );
-    test_boost_from_chars<T>( data, general, label );
+    test_strtox<T>( h, data, general, format );
+    test_std_from_chars<T>( h, data, general, format );
+    test_boost_from_chars<T>( h, data, general, format );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 }
 
-template<class T> static void test2()
+template<class T> static void test2( bench::harness& h )
 {
     std::vector<std::string> data;
     init_input_data_uint64<T>( data );
 
     bool general = true;
-    char const* label = "uint64";
+    char const* format = "uint64";
 
-    test_strtox<T>( data, general, label );
-    test_std_from_chars<T>( data, general, label );
-    test_boost_from_chars<T>( data, general, label );
+    test_strtox<T>( h, data, general, format );
+    test_std_from_chars<T>( h, data, general, format );
+    test_boost_from_chars<T>( h, data, general, format );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 }
 
-int main()
+int main( int argc, char** argv )
 {
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    test<float>( h, false );
+    test<double>( h, false );
+    test<long double>( h, false );
 
-    test<float>( false );
-    test<double>( false );
-    test<long double>( false );
+    test<float>( h, true );
+    test<double>( h, true );
+    test<long double>( h, true );
 
-    test<float>( true );
-    test<double>( true );
-    test<long double>( true );
+    test2<float>( h );
+    test2<double>( h );
 
-    test2<float>();
-    test2<double>();
+    return h.finish();
 }
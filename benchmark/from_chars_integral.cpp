@@ -7,15 +7,14 @@
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/config.hpp>
+#include "harness.hpp"
 #include <type_traits>
-#include <chrono>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <string>
+#include <vector>
 #include <charconv>
 
 constexpr unsigned N = 2'000'000;
-constexpr int K = 25;
 
 template<class T> static BOOST_NOINLINE void init_input_data( std::vector<std::string>& data )
 {
@@ -35,80 +34,78 @@ template<class T> static BOOST_NOINLINE void init_input_data( std::vector<std::s
     }
 }
 
-using namespace std::chrono_literals;
-
-template<class T> static void BOOST_NOINLINE test_std_from_chars( std::vector<std::string> const& data )
+template<class T> static void BOOST_NOINLINE test_std_from_chars( bench::harness& h, std::vector<std::string> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    h.run( "std::from_chars<" + boost::core::type_name<T>() + ">", data.size(), [&]{
 
-    std::size_t s = 0;
+        std::size_t s = 0;
+        std::size_t n = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
         for( auto const& x: data )
         {
-            T y;
-            std::from_chars( x.data(), x.data() + x.size(), y );
+            T y {};
+            auto r = std::from_chars( x.data(), x.data() + x.size(), y );
 
             s += static_cast<std::size_t>( y );
+            n += static_cast<std::size_t>( r.ptr - x.data() );
         }
-    }
-
-    auto t2 = std::chrono::steady_clock::now();
 
-    std::cout << "            std::from_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        bench::do_not_optimize( s );
+        return n;
+    });
 }
 
-template<class T> static void BOOST_NOINLINE test_boost_from_chars( std::vector<std::string> const& data )
+template<class T> static void BOOST_NOINLINE test_boost_from_chars( bench::harness& h, std::vector<std::string> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    h.run( "boost::charconv::from_chars<" + boost::core::type_name<T>() + ">", data.size(), [&]{
 
-    std::size_t s = 0;
+        std::size_t s = 0;
+        std::size_t n = 0;
 
-    for( int i = 0; i < K; ++i )
-    {
         for( auto const& x: data )
         {
-            T y;
-            boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+            T y {};
+            auto r = boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
 
             s += static_cast<std::size_t>( y );
+            n += static_cast<std::size_t>( r.ptr - x.data() );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::from_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        bench::do_not_optimize( s );
+        return n;
+    });
 }
 
-template<class T> static void test()
+template<class T> static void test( bench::harness& h )
 {
     std::vector<std::string> data;
     init_input_data<T>( data );
 
-    test_std_from_chars<T>( data );
-    test_boost_from_chars<T>( data );
+    test_std_from_chars<T>( h, data );
+    test_boost_from_chars<T>( h, data );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 }
 
-int main()
+int main( int argc, char** argv )
 {
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    test<signed char>( h );
+    test<unsigned char>( h );
 
-    test<signed char>();
-    test<unsigned char>();
+    test<short>( h );
+    test<unsigned short>( h );
 
-    test<short>();
-    test<unsigned short>();
+    test<int>( h );
+    test<unsigned int>( h );
 
-    test<int>();
-    test<unsigned int>();
+    test<long>( h );
+    test<unsigned long>( h );
 
-    test<long>();
-    test<unsigned long>();
+    test<long long>( h );
+    test<unsigned long long>( h );
 
-    test<long long>();
-    test<unsigned long long>();
+    return h.finish();
 }
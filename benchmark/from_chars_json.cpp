@@ -0,0 +1,151 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses an array of JSON numbers the way a JSON library has to: checking the RFC 8259
+// grammar in a separate pass before from_chars, and with chars_format::json, which checks
+// it in the pass that computes the value. Results are in MB/s of JSON text.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr std::size_t N = 1'000'000;
+
+// Shortest doubles, integers and prices, separated by ','
+static std::string make_json()
+{
+    boost::detail::splitmix64 rng;
+    std::string text;
+
+    for( std::size_t i = 0; i < N; )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+
+        switch( i % 3 )
+        {
+        case 0: std::memcpy( &x, &tmp, sizeof( x ) ); break;
+        case 1: x = static_cast<double>( static_cast<std::int32_t>( tmp ) ); break;
+        default: x = static_cast<double>( tmp % 1000000 ) / 100; break;
+        }
+
+        if( !std::isfinite( x ) ) continue;
+
+        char buffer[ 32 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+
+        text.append( buffer, r.ptr );
+        text += ',';
+        ++i;
+    }
+
+    text.back() = ']';
+    return text;
+}
+
+static bool is_digit( char c )
+{
+    return c >= '0' && c <= '9';
+}
+
+// The usual hand written validator: returns the end of the number, or nullptr
+static char const* validate_json_number( char const* p, char const* last )
+{
+    if( p != last && *p == '-' ) ++p;
+    if( p == last ) return nullptr;
+
+    if( *p == '0' )
+    {
+        ++p;
+    }
+    else if( is_digit( *p ) )
+    {
+        while( p != last && is_digit( *p ) ) ++p;
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    if( p != last && *p == '.' )
+    {
+        ++p;
+        if( p == last || !is_digit( *p ) ) return nullptr;
+        while( p != last && is_digit( *p ) ) ++p;
+    }
+
+    if( p != last && ( *p == 'e' || *p == 'E' ) )
+    {
+        ++p;
+        if( p != last && ( *p == '+' || *p == '-' ) ) ++p;
+        if( p == last || !is_digit( *p ) ) return nullptr;
+        while( p != last && is_digit( *p ) ) ++p;
+    }
+
+    return p;
+}
+
+static std::size_t validate_then_parse( std::string const& text, std::vector<double>& out )
+{
+    char const* p = text.data();
+    char const* const last = text.data() + text.size();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char const* end = validate_json_number( p, last );
+        if( end == nullptr || ( *end != ',' && *end != ']' ) ) return 0;
+
+        auto r = boost::charconv::from_chars( p, end, out[ i ] );
+        if( !r ) return 0;
+
+        p = end + 1;
+    }
+
+    return text.size();
+}
+
+static std::size_t parse_json( std::string const& text, std::vector<double>& out )
+{
+    char const* p = text.data();
+    char const* const last = text.data() + text.size();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        auto r = boost::charconv::from_chars( p, last, out[ i ], boost::charconv::chars_format::json );
+        if( !r || ( *r.ptr != ',' && *r.ptr != ']' ) ) return 0;
+
+        p = r.ptr + 1;
+    }
+
+    return text.size();
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    std::string const text = make_json();
+
+    std::vector<double> expected( N ), out( N );
+
+    if( validate_then_parse( text, expected ) == 0 || parse_json( text, out ) == 0 || out != expected )
+    {
+        std::fprintf( stderr, "The methods do not agree\n" );
+        return 1;
+    }
+
+    h.run( "validate + from_chars", N, [&]{ return validate_then_parse( text, out ); } );
+    h.run( "from_chars chars_format::json", N, [&]{ return parse_json( text, out ); } );
+
+    return h.finish();
+}
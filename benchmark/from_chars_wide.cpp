@@ -0,0 +1,113 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses UTF-16 text of doubles and of int64 values separated by ',': by transcoding each number
+// into a char buffer for from_chars, and with the char16_t overloads of from_chars.
+// Results are in MB/s of UTF-16 text.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr std::size_t N = 1'000'000;
+
+template<class T> static std::u16string make_text()
+{
+    boost::detail::splitmix64 rng;
+    std::u16string text;
+
+    for( std::size_t i = 0; i < N; )
+    {
+        std::uint64_t tmp = rng();
+
+        T x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( !std::isfinite( static_cast<double>( x ) ) ) continue;
+
+        char buffer[ 32 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+
+        text.append( buffer, r.ptr );
+        text += u',';
+        ++i;
+    }
+
+    return text;
+}
+
+template<class T> static std::size_t transcode_then_parse( std::u16string const& text, std::vector<T>& out )
+{
+    char16_t const* p = text.data();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        char buffer[ 64 ];
+        std::size_t n = 0;
+
+        while( p[ n ] != u',' && n < sizeof( buffer ) )
+        {
+            buffer[ n ] = static_cast<char>( p[ n ] );
+            ++n;
+        }
+
+        auto r = boost::charconv::from_chars( buffer, buffer + n, out[ i ] );
+        if( !r ) return 0;
+
+        p += ( r.ptr - buffer ) + 1;
+    }
+
+    return text.size() * sizeof( char16_t );
+}
+
+template<class T> static std::size_t parse_wide( std::u16string const& text, std::vector<T>& out )
+{
+    char16_t const* p = text.data();
+    char16_t const* const last = text.data() + text.size();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        auto r = boost::charconv::from_chars( p, last, out[ i ] );
+        if( !r ) return 0;
+
+        p = r.ptr + 1;
+    }
+
+    return text.size() * sizeof( char16_t );
+}
+
+template<class T> static bool run( bench::harness& h, char const* type )
+{
+    std::u16string const text = make_text<T>();
+
+    std::vector<T> expected( N ), out( N );
+
+    if( transcode_then_parse( text, expected ) == 0 || parse_wide( text, out ) == 0 || out != expected )
+    {
+        std::fprintf( stderr, "The methods do not agree for %s\n", type );
+        return false;
+    }
+
+    h.run( std::string( type ) + ", transcode + from_chars", N, [&]{ return transcode_then_parse( text, out ); } );
+    h.run( std::string( type ) + ", from_chars char16_t", N, [&]{ return parse_wide( text, out ); } );
+
+    return true;
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( !run<double>( h, "double" ) || !run<std::int64_t>( h, "int64" ) ) return 1;
+
+    return h.finish();
+}
@@ -0,0 +1,888 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Driver shared by the benchmark programs. Every measurement is warmed up,
+// sampled several times, and reported as the median and the median absolute
+// deviation (MAD) of the time per operation. The results can be written as
+// JSON and two such files can be diffed with compare.cpp.
+//
+// harness::latency times single calls instead, and reports their distribution.
+//
+// Common options:
+//   --json <file>        write the results to <file>
+//   --warmup <n>         untimed runs before sampling (default 1)
+//   --repetitions <n>    timed samples (default 10)
+//   --filter <text>      only run benchmarks whose name contains <text>
+//   --counters           also read the hardware counters (Linux perf events) around each sample
+//   --cold               evict the caches before every call timed by harness::latency
+
+#ifndef BOOST_CHARCONV_BENCHMARK_HARNESS_HPP_INCLUDED
+#define BOOST_CHARCONV_BENCHMARK_HARNESS_HPP_INCLUDED
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if !defined(_MSC_VER) || defined(__clang__)
+#include <x86intrin.h>
+#endif
+#define BOOST_CHARCONV_BENCHMARK_HAS_RDTSC
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#define BOOST_CHARCONV_BENCHMARK_HAS_PERF_EVENTS
+#endif
+
+namespace bench
+{
+
+// Forces x to be materialized so that the computation of x can not be elided
+template<class T> inline void do_not_optimize( T const& x )
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__( "" : : "m"( x ) : "memory" );
+#else
+    static void const volatile* sink;
+    sink = &x;
+    _ReadWriteBarrier();
+#endif
+}
+
+// Time stamps for single calls: the time stamp counter on x86, the steady clock in ns elsewhere
+inline std::uint64_t ticks_start() noexcept
+{
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_RDTSC
+    _mm_lfence();
+    std::uint64_t const t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    return static_cast<std::uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+#endif
+}
+
+inline std::uint64_t ticks_stop() noexcept
+{
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_RDTSC
+    unsigned aux;
+    std::uint64_t const t = __rdtscp( &aux );
+    _mm_lfence();
+    return t;
+#else
+    return ticks_start();
+#endif
+}
+
+struct tick_calibration
+{
+    double ns_per_tick;
+
+    // Smallest time measured around nothing, which is subtracted from every sample
+    std::uint64_t overhead;
+};
+
+inline tick_calibration calibrate_ticks()
+{
+    tick_calibration c{ 1, 0 };
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_RDTSC
+    auto const t1 = std::chrono::steady_clock::now();
+    std::uint64_t const c1 = ticks_start();
+
+    auto t2 = t1;
+    while( t2 - t1 < std::chrono::milliseconds( 20 ) ) t2 = std::chrono::steady_clock::now();
+
+    std::uint64_t const c2 = ticks_stop();
+
+    c.ns_per_tick = std::chrono::duration<double, std::nano>( t2 - t1 ).count() / static_cast<double>( c2 - c1 );
+#endif
+
+    c.overhead = UINT64_MAX;
+
+    for( int i = 0; i < 10000; ++i )
+    {
+        std::uint64_t const a = ticks_start();
+        std::uint64_t const b = ticks_stop();
+
+        c.overhead = ( std::min )( c.overhead, b - a );
+    }
+
+    return c;
+}
+
+// About 64 KB of straight line code that cache_evictor runs to push the measured code out
+// of the instruction cache. Every step depends on the previous one, so none can be removed,
+// and the constants differ between the functions so that the linker can not fold them.
+#define BOOST_CHARCONV_BENCHMARK_STEP( k ) x ^= x >> 29; x *= 0x9E3779B97F4A7C15ull + k;
+#define BOOST_CHARCONV_BENCHMARK_STEP4( k ) BOOST_CHARCONV_BENCHMARK_STEP( k ) BOOST_CHARCONV_BENCHMARK_STEP( k ) BOOST_CHARCONV_BENCHMARK_STEP( k ) BOOST_CHARCONV_BENCHMARK_STEP( k )
+#define BOOST_CHARCONV_BENCHMARK_STEP16( k ) BOOST_CHARCONV_BENCHMARK_STEP4( k ) BOOST_CHARCONV_BENCHMARK_STEP4( k ) BOOST_CHARCONV_BENCHMARK_STEP4( k ) BOOST_CHARCONV_BENCHMARK_STEP4( k )
+#define BOOST_CHARCONV_BENCHMARK_STEP64( k ) BOOST_CHARCONV_BENCHMARK_STEP16( k ) BOOST_CHARCONV_BENCHMARK_STEP16( k ) BOOST_CHARCONV_BENCHMARK_STEP16( k ) BOOST_CHARCONV_BENCHMARK_STEP16( k )
+#define BOOST_CHARCONV_BENCHMARK_STEP256( k ) BOOST_CHARCONV_BENCHMARK_STEP64( k ) BOOST_CHARCONV_BENCHMARK_STEP64( k ) BOOST_CHARCONV_BENCHMARK_STEP64( k ) BOOST_CHARCONV_BENCHMARK_STEP64( k )
+#define BOOST_CHARCONV_BENCHMARK_CODE( k ) BOOST_NOINLINE inline std::uint64_t run_code_##k( std::uint64_t x ) noexcept { BOOST_CHARCONV_BENCHMARK_STEP256( k ) return x; }
+
+BOOST_CHARCONV_BENCHMARK_CODE( 0 )
+BOOST_CHARCONV_BENCHMARK_CODE( 1 )
+BOOST_CHARCONV_BENCHMARK_CODE( 2 )
+BOOST_CHARCONV_BENCHMARK_CODE( 3 )
+BOOST_CHARCONV_BENCHMARK_CODE( 4 )
+BOOST_CHARCONV_BENCHMARK_CODE( 5 )
+BOOST_CHARCONV_BENCHMARK_CODE( 6 )
+BOOST_CHARCONV_BENCHMARK_CODE( 7 )
+BOOST_CHARCONV_BENCHMARK_CODE( 8 )
+BOOST_CHARCONV_BENCHMARK_CODE( 9 )
+BOOST_CHARCONV_BENCHMARK_CODE( 10 )
+BOOST_CHARCONV_BENCHMARK_CODE( 11 )
+BOOST_CHARCONV_BENCHMARK_CODE( 12 )
+BOOST_CHARCONV_BENCHMARK_CODE( 13 )
+BOOST_CHARCONV_BENCHMARK_CODE( 14 )
+BOOST_CHARCONV_BENCHMARK_CODE( 15 )
+
+#undef BOOST_CHARCONV_BENCHMARK_CODE
+#undef BOOST_CHARCONV_BENCHMARK_STEP256
+#undef BOOST_CHARCONV_BENCHMARK_STEP64
+#undef BOOST_CHARCONV_BENCHMARK_STEP16
+#undef BOOST_CHARCONV_BENCHMARK_STEP4
+#undef BOOST_CHARCONV_BENCHMARK_STEP
+
+inline std::uint64_t run_code( std::uint64_t x ) noexcept
+{
+    x = run_code_0( x ); x = run_code_1( x ); x = run_code_2( x ); x = run_code_3( x );
+    x = run_code_4( x ); x = run_code_5( x ); x = run_code_6( x ); x = run_code_7( x );
+    x = run_code_8( x ); x = run_code_9( x ); x = run_code_10( x ); x = run_code_11( x );
+    x = run_code_12( x ); x = run_code_13( x ); x = run_code_14( x ); x = run_code_15( x );
+    return x;
+}
+
+// Evicts the caches of the calling core by reading a buffer larger than L1 and L2, and by
+// running more code than the L1 instruction cache holds.
+// It also leaves the branch predictors without the history of the measured code.
+class cache_evictor
+{
+public:
+
+    // Larger than the L2 cache of current x86 cores
+    static constexpr std::size_t default_bytes = std::size_t( 8 ) << 20;
+
+    void resize( std::size_t bytes )
+    {
+        buffer_.assign( bytes / sizeof( std::uint64_t ), 1 );
+    }
+
+    void evict() noexcept
+    {
+        std::uint64_t s = 0;
+
+        // One read per 64 byte cache line
+        for( std::size_t i = 0; i < buffer_.size(); i += 8 )
+        {
+            s += buffer_[ i ];
+        }
+
+        s = run_code( s );
+        do_not_optimize( s );
+    }
+
+private:
+
+    std::vector<std::uint64_t> buffer_;
+};
+
+// Hardware counters around the measured loops. Opening them fails without a PMU or when
+// perf_event_paranoid forbids it, as is common in containers, and the results then have no counters.
+class perf_counters
+{
+public:
+
+    enum { cycles, instructions, branch_misses, l1d_misses, count };
+
+    static char const* name( int i ) noexcept
+    {
+        static char const* const names[ count ] = { "cycles", "instructions", "branch_misses", "l1d_misses" };
+        return names[ i ];
+    }
+
+    perf_counters() = default;
+    perf_counters( perf_counters const& ) = delete;
+    perf_counters& operator=( perf_counters const& ) = delete;
+
+    ~perf_counters()
+    {
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_PERF_EVENTS
+        for( int fd: fd_ )
+        {
+            if( fd != -1 ) close( fd );
+        }
+#endif
+    }
+
+    // Returns false with a reason if none of the counters is available
+    bool open( std::string& error )
+    {
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_PERF_EVENTS
+
+        std::uint32_t const types[ count ] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE };
+
+        std::uint64_t const configs[ count ] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_MISSES,
+            PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 )
+        };
+
+        int first_errno = 0;
+
+        for( int i = 0; i < count; ++i )
+        {
+            perf_event_attr attr;
+            std::memset( &attr, 0, sizeof( attr ) );
+
+            attr.size = sizeof( attr );
+            attr.type = types[ i ];
+            attr.config = configs[ i ];
+            attr.disabled = leader_ == -1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            long const fd = syscall( SYS_perf_event_open, &attr, 0, -1, leader_, 0 );
+
+            if( fd == -1 )
+            {
+                if( first_errno == 0 ) first_errno = errno;
+                continue;
+            }
+
+            fd_[ i ] = static_cast<int>( fd );
+
+            if( leader_ == -1 ) leader_ = fd_[ i ];
+
+            if( ioctl( fd_[ i ], PERF_EVENT_IOC_ID, &id_[ i ] ) == -1 )
+            {
+                close( fd_[ i ] );
+                fd_[ i ] = -1;
+            }
+        }
+
+        if( leader_ == -1 )
+        {
+            error = std::strerror( first_errno );
+            return false;
+        }
+
+        return true;
+
+#else
+
+        error = "perf events are only supported on Linux";
+        return false;
+
+#endif
+    }
+
+    void start() noexcept
+    {
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_PERF_EVENTS
+        ioctl( leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+        ioctl( leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+#endif
+    }
+
+    // Counts since start, scaled up if the counters were multiplexed; -1 for unavailable counters
+    void stop( double (&values)[ count ] ) noexcept
+    {
+        for( double& v: values ) v = -1;
+
+#ifdef BOOST_CHARCONV_BENCHMARK_HAS_PERF_EVENTS
+
+        ioctl( leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+
+        // nr, time_enabled, time_running, then a value and id pair per counter
+        std::uint64_t buffer[ 3 + 2 * count ];
+
+        ssize_t const n = read( leader_, buffer, sizeof( buffer ) );
+        if( n < static_cast<ssize_t>( 3 * sizeof( std::uint64_t ) ) || buffer[ 2 ] == 0 ) return;
+
+        double const scale = static_cast<double>( buffer[ 1 ] ) / static_cast<double>( buffer[ 2 ] );
+
+        for( std::uint64_t j = 0; j < buffer[ 0 ] && j < count; ++j )
+        {
+            for( int i = 0; i < count; ++i )
+            {
+                if( fd_[ i ] != -1 && id_[ i ] == buffer[ 4 + 2 * j ] )
+                {
+                    values[ i ] = static_cast<double>( buffer[ 3 + 2 * j ] ) * scale;
+                }
+            }
+        }
+
+#endif
+    }
+
+private:
+
+    int fd_[ count ] = { -1, -1, -1, -1 };
+    int leader_ = -1;
+    std::uint64_t id_[ count ] = {};
+};
+
+struct result
+{
+    std::string name;
+
+    // Operations and characters read or written per sample
+    std::size_t ops;
+    std::size_t bytes;
+
+    // Time per operation
+    double median_ns;
+    double mad_ns;
+    double min_ns;
+
+    double mb_per_s;
+
+    // Per operation, -1 if not measured
+    double counters[ perf_counters::count ];
+
+    // Percentiles of single calls, -1 if not measured
+    double p50_ns;
+    double p90_ns;
+    double p99_ns;
+    double p999_ns;
+    double max_ns;
+};
+
+// Value below which a fraction q of the sorted samples fall
+inline double percentile( std::vector<double> const& sorted, double q )
+{
+    std::size_t const i = static_cast<std::size_t>( q * static_cast<double>( sorted.size() ) );
+    return sorted[ ( std::min )( i, sorted.size() - 1 ) ];
+}
+
+// One line per power of two of ns between the fastest and the slowest call
+inline void print_histogram( std::vector<double> const& sorted )
+{
+    std::size_t counts[ 64 ] = {};
+    int lo = 63, hi = 0;
+
+    for( double x: sorted )
+    {
+        int b = 0;
+        while( b < 63 && x >= static_cast<double>( std::uint64_t( 2 ) << b ) ) ++b;
+
+        ++counts[ b ];
+        lo = ( std::min )( lo, b );
+        hi = ( std::max )( hi, b );
+    }
+
+    std::size_t const peak = *std::max_element( counts, counts + 64 );
+
+    for( int b = lo; b <= hi; ++b )
+    {
+        double const from = b == 0? 0: static_cast<double>( std::uint64_t( 1 ) << b );
+        double const to = static_cast<double>( std::uint64_t( 2 ) << b );
+
+        int const width = static_cast<int>( 50 * counts[ b ] / peak );
+        double const share = 100.0 * static_cast<double>( counts[ b ] ) / static_cast<double>( sorted.size() );
+
+        std::printf( "  %8.0f - %-8.0f ns %8.4f%% |%.*s\n", from, to, share, width, "##################################################" );
+    }
+}
+
+inline double median( std::vector<double> v )
+{
+    if( v.empty() ) return 0;
+
+    std::ptrdiff_t const n = static_cast<std::ptrdiff_t>( v.size() / 2 );
+    std::nth_element( v.begin(), v.begin() + n, v.end() );
+
+    double m = v.begin()[ n ];
+
+    if( v.size() % 2 == 0 )
+    {
+        m = ( m + *std::max_element( v.begin(), v.begin() + n ) ) / 2;
+    }
+
+    return m;
+}
+
+inline double median_absolute_deviation( std::vector<double> const& v, double m )
+{
+    std::vector<double> d;
+    d.reserve( v.size() );
+
+    for( double x: v )
+    {
+        d.push_back( std::fabs( x - m ) );
+    }
+
+    return median( std::move( d ) );
+}
+
+inline std::string json_escape( std::string const& s )
+{
+    std::string r;
+
+    for( char c: s )
+    {
+        if( c == '"' || c == '\\' )
+        {
+            r += '\\';
+            r += c;
+        }
+        else if( static_cast<unsigned char>( c ) < 0x20 )
+        {
+            char buffer[ 8 ];
+            std::snprintf( buffer, sizeof( buffer ), "\\u%04x", static_cast<unsigned>( c ) );
+            r += buffer;
+        }
+        else
+        {
+            r += c;
+        }
+    }
+
+    return r;
+}
+
+class harness
+{
+public:
+
+    harness( int argc, char** argv ): program_( argc > 0? argv[ 0 ]: "benchmark" )
+    {
+        std::size_t const slash = program_.find_last_of( "/\\" );
+
+        if( slash != std::string::npos )
+        {
+            program_.erase( 0, slash + 1 );
+        }
+
+        for( int i = 1; i < argc; ++i )
+        {
+            std::string const arg = argv[ i ];
+
+            if( arg == "--json" && i + 1 < argc )
+            {
+                json_ = argv[ ++i ];
+            }
+            else if( arg == "--warmup" && i + 1 < argc )
+            {
+                warmup_ = std::atoi( argv[ ++i ] );
+            }
+            else if( arg == "--repetitions" && i + 1 < argc )
+            {
+                repetitions_ = std::atoi( argv[ ++i ] );
+            }
+            else if( arg == "--filter" && i + 1 < argc )
+            {
+                filter_ = argv[ ++i ];
+            }
+            else if( arg == "--counters" )
+            {
+                use_counters_ = true;
+            }
+            else if( arg == "--cold" )
+            {
+                cold_ = true;
+            }
+            else if( arg.compare( 0, 2, "--" ) == 0 )
+            {
+                std::fprintf( stderr, "Usage: %s [--json <file>] [--warmup <n>] [--repetitions <n>] [--filter <text>] [--counters] [--cold]\n", program_.c_str() );
+                ok_ = false;
+            }
+            else
+            {
+                args_.push_back( arg );
+            }
+        }
+
+        if( warmup_ < 0 || repetitions_ < 1 )
+        {
+            std::fprintf( stderr, "%s: --warmup must be >= 0 and --repetitions must be >= 1\n", program_.c_str() );
+            ok_ = false;
+        }
+
+        if( ok_ )
+        {
+            std::printf( "%s\n%s\n%s\n\n", BOOST_COMPILER, BOOST_STDLIB, BOOST_PLATFORM );
+        }
+
+        if( ok_ && use_counters_ )
+        {
+            std::string error;
+
+            if( !counters_.open( error ) )
+            {
+                std::printf( "Hardware counters are not available (%s), only measuring time\n\n", error.c_str() );
+                use_counters_ = false;
+            }
+        }
+
+        if( ok_ && cold_ )
+        {
+            evictor_.resize( cache_evictor::default_bytes );
+        }
+    }
+
+    harness( harness const& ) = delete;
+    harness& operator=( harness const& ) = delete;
+
+    // Calls timed per repetition by latency with --cold
+    static constexpr std::size_t cold_samples = 500;
+
+    // false if the command line was invalid
+    bool ok() const noexcept
+    {
+        return ok_;
+    }
+
+    // Arguments that are not harness options, in order
+    std::vector<std::string> const& args() const noexcept
+    {
+        return args_;
+    }
+
+    std::vector<result> const& results() const noexcept
+    {
+        return results_;
+    }
+
+    // f performs ops operations and returns the number of characters it read or wrote,
+    // which is used for the MB/s figure (0 if it does not apply)
+    template<class F> void run( std::string const& name, std::size_t ops, F&& f )
+    {
+        if( !filter_.empty() && name.find( filter_ ) == std::string::npos ) return;
+
+        for( int i = 0; i < warmup_; ++i )
+        {
+            std::size_t bytes = f();
+            do_not_optimize( bytes );
+        }
+
+        std::vector<double> samples;
+        samples.reserve( static_cast<std::size_t>( repetitions_ ) );
+
+        std::size_t bytes = 0;
+
+        double totals[ perf_counters::count ] = {};
+
+        for( int i = 0; i < repetitions_; ++i )
+        {
+            if( use_counters_ ) counters_.start();
+
+            auto t1 = std::chrono::steady_clock::now();
+
+            bytes = f();
+            do_not_optimize( bytes );
+
+            auto t2 = std::chrono::steady_clock::now();
+
+            if( use_counters_ )
+            {
+                double values[ perf_counters::count ];
+                counters_.stop( values );
+
+                for( int j = 0; j < perf_counters::count; ++j )
+                {
+                    totals[ j ] = values[ j ] < 0 || totals[ j ] < 0? -1: totals[ j ] + values[ j ];
+                }
+            }
+
+            samples.push_back( std::chrono::duration<double, std::nano>( t2 - t1 ).count() / static_cast<double>( ops ) );
+        }
+
+        result r;
+
+        r.name = name;
+        r.ops = ops;
+        r.bytes = bytes;
+        r.median_ns = median( samples );
+        r.mad_ns = median_absolute_deviation( samples, r.median_ns );
+        r.min_ns = *std::min_element( samples.begin(), samples.end() );
+        r.mb_per_s = r.median_ns > 0? static_cast<double>( bytes ) / ( r.median_ns * static_cast<double>( ops ) ) * 1e3: 0;
+
+        for( int j = 0; j < perf_counters::count; ++j )
+        {
+            r.counters[ j ] = use_counters_ && totals[ j ] >= 0? totals[ j ] / ( static_cast<double>( ops ) * repetitions_ ): -1;
+        }
+
+        r.p50_ns = r.p90_ns = r.p99_ns = r.p999_ns = r.max_ns = -1;
+
+        if( r.mb_per_s > 0 )
+        {
+            std::printf( "%-60s %10.2f ns/op (+-%.2f) %10.1f MB/s\n", name.c_str(), r.median_ns, r.mad_ns, r.mb_per_s );
+        }
+        else
+        {
+            std::printf( "%-60s %10.2f ns/op (+-%.2f)\n", name.c_str(), r.median_ns, r.mad_ns );
+        }
+
+        if( use_counters_ )
+        {
+            std::printf( "%-60s", "" );
+
+            for( int j = 0; j < perf_counters::count; ++j )
+            {
+                if( r.counters[ j ] >= 0 ) std::printf( " %s/op %.2f", perf_counters::name( j ), r.counters[ j ] );
+            }
+
+            if( r.counters[ perf_counters::cycles ] > 0 && r.counters[ perf_counters::instructions ] >= 0 )
+            {
+                std::printf( " IPC %.2f", r.counters[ perf_counters::instructions ] / r.counters[ perf_counters::cycles ] );
+            }
+
+            std::printf( "\n" );
+        }
+
+        std::fflush( stdout );
+
+        results_.push_back( std::move( r ) );
+    }
+
+    // Times every call f( i ) for i in [0, n) separately, once per repetition, and reports the
+    // distribution. f returns a value that depends on the result of the call.
+    // With --cold the caches are evicted before every call, and as that takes much longer
+    // than the call, only cold_samples of the n inputs are used.
+    template<class F> void latency( std::string name, std::size_t n, F&& f )
+    {
+        if( !filter_.empty() && name.find( filter_ ) == std::string::npos ) return;
+
+        std::size_t const m = cold_? ( std::min )( n, cold_samples ): n;
+        if( cold_ ) name += ", cold";
+
+        if( calibration_.ns_per_tick == 0 )
+        {
+            calibration_ = calibrate_ticks();
+        }
+
+        for( int i = 0; i < warmup_; ++i )
+        {
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                auto x = f( j );
+                do_not_optimize( x );
+            }
+        }
+
+        std::vector<double> samples;
+        samples.reserve( m * static_cast<std::size_t>( repetitions_ ) );
+
+        for( int i = 0; i < repetitions_; ++i )
+        {
+            for( std::size_t k = 0; k < m; ++k )
+            {
+                // Spread over all the inputs when only some are used
+                std::size_t const j = k * n / m;
+
+                if( cold_ ) evictor_.evict();
+
+                std::uint64_t const t1 = ticks_start();
+
+                auto x = f( j );
+                do_not_optimize( x );
+
+                std::uint64_t const t2 = ticks_stop();
+
+                std::uint64_t const ticks = t2 - t1 > calibration_.overhead? t2 - t1 - calibration_.overhead: 0;
+                samples.push_back( static_cast<double>( ticks ) * calibration_.ns_per_tick );
+            }
+        }
+
+        std::sort( samples.begin(), samples.end() );
+
+        result r;
+
+        r.name = name;
+        r.ops = samples.size();
+        r.bytes = 0;
+        r.median_ns = percentile( samples, 0.5 );
+        r.mad_ns = median_absolute_deviation( samples, r.median_ns );
+        r.min_ns = samples.front();
+        r.mb_per_s = 0;
+
+        for( double& c: r.counters ) c = -1;
+
+        r.p50_ns = r.median_ns;
+        r.p90_ns = percentile( samples, 0.9 );
+        r.p99_ns = percentile( samples, 0.99 );
+        r.p999_ns = percentile( samples, 0.999 );
+        r.max_ns = samples.back();
+
+        std::printf( "%-60s p50 %.1f p90 %.1f p99 %.1f p99.9 %.1f max %.1f ns\n", name.c_str(), r.p50_ns, r.p90_ns, r.p99_ns, r.p999_ns, r.max_ns );
+        print_histogram( samples );
+        std::fflush( stdout );
+
+        results_.push_back( std::move( r ) );
+    }
+
+    // Writes the JSON report if one was requested; returns the exit code for main
+    int finish() const
+    {
+        if( !ok_ ) return 2;
+        if( json_.empty() ) return 0;
+
+        std::FILE* f = std::fopen( json_.c_str(), "w" );
+
+        if( f == nullptr )
+        {
+            std::fprintf( stderr, "%s: unable to open %s\n", program_.c_str(), json_.c_str() );
+            return 1;
+        }
+
+        std::fprintf( f, "{\n  \"context\": {\n" );
+        std::fprintf( f, "    \"program\": \"%s\",\n", json_escape( program_ ).c_str() );
+        std::fprintf( f, "    \"compiler\": \"%s\",\n", json_escape( BOOST_COMPILER ).c_str() );
+        std::fprintf( f, "    \"stdlib\": \"%s\",\n", json_escape( BOOST_STDLIB ).c_str() );
+        std::fprintf( f, "    \"platform\": \"%s\",\n", json_escape( BOOST_PLATFORM ).c_str() );
+        std::fprintf( f, "    \"warmup\": %d,\n    \"repetitions\": %d,\n    \"cold\": %s\n  },\n", warmup_, repetitions_, cold_? "true": "false" );
+        std::fprintf( f, "  \"benchmarks\": [" );
+
+        for( std::size_t i = 0; i < results_.size(); ++i )
+        {
+            result const& r = results_[ i ];
+
+            std::fprintf( f, "%s\n    { \"name\": \"%s\", \"ops\": %zu, \"bytes\": %zu, \"median_ns\": %.4f, \"mad_ns\": %.4f, \"min_ns\": %.4f, \"mb_per_s\": %.2f",
+                i == 0? "": ",", json_escape( r.name ).c_str(), r.ops, r.bytes, r.median_ns, r.mad_ns, r.min_ns, r.mb_per_s );
+
+            for( int j = 0; j < perf_counters::count; ++j )
+            {
+                if( r.counters[ j ] >= 0 ) std::fprintf( f, ", \"%s_per_op\": %.4f", perf_counters::name( j ), r.counters[ j ] );
+            }
+
+            if( r.p50_ns >= 0 )
+            {
+                std::fprintf( f, ", \"p50_ns\": %.4f, \"p90_ns\": %.4f, \"p99_ns\": %.4f, \"p999_ns\": %.4f, \"max_ns\": %.4f", r.p50_ns, r.p90_ns, r.p99_ns, r.p999_ns, r.max_ns );
+            }
+
+            std::fprintf( f, " }" );
+        }
+
+        std::fprintf( f, "\n  ]\n}\n" );
+
+        bool const written = std::ferror( f ) == 0;
+
+        if( std::fclose( f ) != 0 || !written )
+        {
+            std::fprintf( stderr, "%s: error writing %s\n", program_.c_str(), json_.c_str() );
+            return 1;
+        }
+
+        return 0;
+    }
+
+private:
+
+    std::string program_;
+    std::string json_;
+    std::string filter_;
+    std::vector<std::string> args_;
+    std::vector<result> results_;
+    perf_counters counters_;
+    cache_evictor evictor_;
+    tick_calibration calibration_{ 0, 0 };
+
+    int warmup_ = 1;
+    int repetitions_ = 10;
+    bool use_counters_ = false;
+    bool cold_ = false;
+    bool ok_ = true;
+};
+
+// Inputs shared by the programs that measure single conversions
+
+// Values with uniformly random bits, skipping inf and nan; the same sequence in every program
+template<class T> inline std::vector<T> random_values( std::size_t n )
+{
+    std::vector<T> data;
+    data.reserve( n );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < n )
+    {
+        std::uint64_t tmp = rng();
+
+        T x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( std::isfinite( x ) ) data.push_back( x );
+    }
+
+    return data;
+}
+
+// Doubles scaled by a factor just above 1, so that they need the extra digits of long double
+template<> inline std::vector<long double> random_values<long double>( std::size_t n )
+{
+    std::vector<long double> data;
+    data.reserve( n );
+
+    for( double x: random_values<double>( n ) )
+    {
+        data.push_back( static_cast<long double>( x ) * 1.00000000000000000001L );
+    }
+
+    return data;
+}
+
+template<class T> inline std::vector<std::string> shortest_strings( std::vector<T> const& values )
+{
+    std::vector<std::string> data;
+    data.reserve( values.size() );
+
+    for( T x: values )
+    {
+        char buffer[ 64 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+        data.emplace_back( buffer, r.ptr );
+    }
+
+    return data;
+}
+
+// 25 significant digits of the exact midpoint between two adjacent doubles, so that the
+// first 19 digits can not decide the rounding and the fast paths give up
+inline std::vector<std::string> halfway_strings( std::size_t n )
+{
+    std::vector<std::string> data;
+    data.reserve( n );
+
+    for( double x: random_values<double>( n ) )
+    {
+        x = std::fabs( x );
+
+        long double const mid = ( static_cast<long double>( x ) + static_cast<long double>( std::nextafter( x, HUGE_VAL ) ) ) / 2;
+
+        char buffer[ 64 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), mid, boost::charconv::chars_format::scientific, 24 );
+        data.emplace_back( buffer, r.ptr );
+    }
+
+    return data;
+}
+
+} // namespace bench
+
+#endif // BOOST_CHARCONV_BENCHMARK_HARNESS_HPP_INCLUDED
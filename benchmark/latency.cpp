@@ -0,0 +1,91 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Latency distribution of single from_chars and to_chars calls.
+// The inputs are chosen so that the slower algorithms show up as the tail they are in
+// a mixed workload: long inputs close to halfway between two doubles need the bigint
+// comparison, large precisions need floff, and long double goes through ryu.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr unsigned N = 10'000;
+
+template<class T> static void test_from_chars( bench::harness& h, char const* label, std::vector<std::string> const& data )
+{
+    h.latency( "boost::charconv::from_chars<" + boost::core::type_name<T>() + ">, " + label, data.size(), [&]( std::size_t i ){
+
+        T y {};
+        boost::charconv::from_chars( data[ i ].data(), data[ i ].data() + data[ i ].size(), y );
+        return y;
+    });
+}
+
+template<class T> static void test_to_chars( bench::harness& h, char const* label, std::vector<T> const& data, boost::charconv::chars_format fmt, int precision = -1 )
+{
+    h.latency( "boost::charconv::to_chars<" + boost::core::type_name<T>() + ">, " + label, data.size(), [&]( std::size_t i ){
+
+        char buffer[ 1024 ];
+        auto r = precision == -1? boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), data[ i ], fmt ):
+                                  boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), data[ i ], fmt, precision );
+        bench::do_not_optimize( buffer );
+        return static_cast<std::size_t>( r.ptr - buffer );
+    });
+}
+
+static void test_to_chars( bench::harness& h, char const* label, std::vector<std::uint64_t> const& data )
+{
+    h.latency( "boost::charconv::to_chars<" + boost::core::type_name<std::uint64_t>() + ">, " + label, data.size(), [&]( std::size_t i ){
+
+        char buffer[ 32 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), data[ i ] );
+        bench::do_not_optimize( buffer );
+        return static_cast<std::size_t>( r.ptr - buffer );
+    });
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    auto const floats = bench::random_values<float>( N );
+    auto const doubles = bench::random_values<double>( N );
+    auto const long_doubles = bench::random_values<long double>( N );
+
+    std::vector<std::uint64_t> integers;
+    {
+        boost::detail::splitmix64 rng;
+        for( unsigned i = 0; i < N; ++i ) integers.push_back( rng() );
+    }
+
+    test_from_chars<std::uint64_t>( h, "random", bench::shortest_strings( integers ) );
+    test_from_chars<float>( h, "shortest", bench::shortest_strings( floats ) );
+    test_from_chars<double>( h, "shortest", bench::shortest_strings( doubles ) );
+    test_from_chars<double>( h, "25 digits near halfway", bench::halfway_strings( N ) );
+    test_from_chars<long double>( h, "shortest", bench::shortest_strings( long_doubles ) );
+
+    std::printf( "\n" );
+
+    test_to_chars( h, "random", integers );
+    test_to_chars( h, "shortest", floats, boost::charconv::chars_format::general );
+    test_to_chars( h, "shortest", doubles, boost::charconv::chars_format::general );
+    test_to_chars( h, "scientific, 16", doubles, boost::charconv::chars_format::scientific, 16 );
+    test_to_chars( h, "scientific, 100", doubles, boost::charconv::chars_format::scientific, 100 );
+    test_to_chars( h, "fixed, 50", doubles, boost::charconv::chars_format::fixed, 50 );
+    test_to_chars( h, "shortest", long_doubles, boost::charconv::chars_format::general );
+    test_to_chars( h, "scientific, 30", long_doubles, boost::charconv::chars_format::scientific, 30 );
+
+    return h.finish();
+}
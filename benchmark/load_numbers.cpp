@@ -0,0 +1,126 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Loads a file of newline separated doubles with std::getline and from_chars, and with load_numbers.
+// Usage: load_numbers [harness options] [file]
+//
+// Without a file 2,000,000 random doubles are written to load_numbers_benchmark.txt in the
+// current directory, and removed at the end. The file is read repeatedly, so it is in the
+// page cache after the warmup and the results do not include the cost of the disk.
+
+#include <boost/charconv/load_numbers.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+constexpr std::size_t N = 2'000'000;
+
+static bool write_random_file( char const* path )
+{
+    std::FILE* file = std::fopen( path, "wb" );
+    if( file == nullptr ) return false;
+
+    boost::detail::splitmix64 rng;
+
+    for( std::size_t i = 0; i < N; )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( !std::isfinite( x ) ) continue;
+
+        char buffer[ 32 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+        *r.ptr++ = '\n';
+
+        std::fwrite( buffer, 1, static_cast<std::size_t>( r.ptr - buffer ), file );
+        ++i;
+    }
+
+    return std::fclose( file ) == 0;
+}
+
+static std::size_t getline_load( char const* path, std::vector<double>& out )
+{
+    std::ifstream file( path );
+    std::string line;
+    std::size_t bytes = 0;
+
+    out.clear();
+
+    while( std::getline( file, line ) )
+    {
+        double x;
+        auto r = boost::charconv::from_chars( line.data(), line.data() + line.size(), x );
+
+        if( !r ) break;
+
+        out.push_back( x );
+        bytes += line.size() + 1;
+    }
+
+    return bytes;
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( h.args().size() > 1 )
+    {
+        std::fprintf( stderr, "Usage: %s [harness options] [file]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    std::string const path = h.args().empty()? "load_numbers_benchmark.txt": h.args()[ 0 ];
+
+    if( h.args().empty() && !write_random_file( path.c_str() ) )
+    {
+        std::fprintf( stderr, "Unable to write %s\n", path.c_str() );
+        return 2;
+    }
+
+    // Every method appends to a vector whose capacity is already there
+    std::vector<double> out;
+
+    std::size_t const n = getline_load( path.c_str(), out );
+
+    if( n == 0 )
+    {
+        std::fprintf( stderr, "%s has no numbers\n", path.c_str() );
+        return 2;
+    }
+
+    std::size_t const count = out.size();
+
+    h.run( "std::getline + from_chars", count, [&]{ return getline_load( path.c_str(), out ); } );
+
+    h.run( "load_numbers, vector", count, [&]{
+
+        out.clear();
+        return boost::charconv::load_numbers( path.c_str(), '\n', out ).offset;
+    });
+
+    std::vector<double> buffer( count );
+
+    h.run( "load_numbers, buffer", count, [&]{
+
+        return boost::charconv::load_numbers( path.c_str(), '\n', buffer.data(), buffer.data() + buffer.size() ).offset;
+    });
+
+    if( h.args().empty() ) std::remove( path.c_str() );
+
+    return h.finish();
+}
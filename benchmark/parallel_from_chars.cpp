@@ -0,0 +1,151 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Parses one large newline separated buffer with a from_chars loop, and with parallel_from_chars
+// on 1, 2, 4, ... threads, and reports the speedup over the loop.
+// Usage: parallel_from_chars [harness options] [max threads]
+//
+// Unlike the scaling benchmark, the threads share one input, so the results include the cost
+// of starting the threads, of splitting the buffer, and of copying the values into the output.
+
+#include <boost/charconv/parallel.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// About 40 MB of text, well past the last level cache
+constexpr std::size_t N = 2'000'000;
+
+static std::string random_text()
+{
+    std::string text;
+    text.reserve( N * 24 );
+
+    boost::detail::splitmix64 rng;
+
+    for( std::size_t i = 0; i < N; )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( !std::isfinite( x ) ) continue;
+
+        char buffer[ 32 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+
+        text.append( buffer, r.ptr );
+        text += '\n';
+        ++i;
+    }
+
+    return text;
+}
+
+static std::size_t serial_parse( std::string const& text, std::vector<double>& out )
+{
+    char const* first = text.data();
+    char const* last = first + text.size();
+
+    out.clear();
+
+    while( first != last )
+    {
+        double x;
+        auto r = boost::charconv::from_chars( first, last, x );
+
+        if( !r || ( r.ptr != last && *r.ptr != '\n' ) ) break;
+
+        out.push_back( x );
+        first = r.ptr == last? last: r.ptr + 1;
+    }
+
+    return static_cast<std::size_t>( first - text.data() );
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( h.args().size() > 1 )
+    {
+        std::fprintf( stderr, "Usage: %s [harness options] [max threads]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    unsigned max_threads = std::thread::hardware_concurrency();
+
+    if( h.args().size() == 1 )
+    {
+        auto const& arg = h.args()[ 0 ];
+        auto r = boost::charconv::from_chars( arg.data(), arg.data() + arg.size(), max_threads );
+
+        if( !r || r.ptr != arg.data() + arg.size() || max_threads == 0 )
+        {
+            std::fprintf( stderr, "Invalid number of threads: %s\n", arg.c_str() );
+            return 2;
+        }
+    }
+
+    if( max_threads == 0 ) max_threads = 1;
+
+    std::vector<unsigned> thread_counts;
+
+    for( unsigned t = 1; t < max_threads; t *= 2 ) thread_counts.push_back( t );
+    thread_counts.push_back( max_threads );
+
+    std::string const text = random_text();
+
+    // Both write into a vector whose capacity is already there, as in a loader that is called repeatedly
+    std::vector<double> out;
+    out.reserve( N );
+
+    h.run( "from_chars loop", N, [&]{ return serial_parse( text, out ); } );
+
+    if( h.results().empty() ) return h.finish();
+
+    double const base = h.results().back().median_ns;
+
+    std::vector<double> times;
+
+    for( unsigned threads: thread_counts )
+    {
+        std::size_t const before = h.results().size();
+
+        h.run( "parallel_from_chars, " + std::to_string( threads ) + ( threads == 1? " thread": " threads" ), N, [&]{
+
+            out.clear();
+            auto r = boost::charconv::parallel_from_chars( text.data(), text.data() + text.size(), '\n', out, threads );
+
+            return static_cast<std::size_t>( r.ptr - text.data() );
+        });
+
+        times.push_back( h.results().size() == before? 0: h.results().back().median_ns );
+    }
+
+    std::printf( "%-52s %7s %10s %10s %10s\n", "", "threads", "Mconv/s", "speedup", "efficiency" );
+
+    for( std::size_t i = 0; i < thread_counts.size(); ++i )
+    {
+        if( times[ i ] == 0 ) continue;
+
+        double const speedup = base / times[ i ];
+
+        std::printf( "%-52s %7u %10.1f %9.2fx %9.1f%%\n", "", thread_counts[ i ], 1e3 / times[ i ], speedup, speedup / thread_counts[ i ] * 100 );
+    }
+
+    std::printf( "\n" );
+
+    return h.finish();
+}
@@ -0,0 +1,140 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Writes 2,000,000 doubles separated by newlines with a to_chars loop, and with parallel_to_chars
+// on 1, 2, 4, ... threads, and reports the speedup over the loop.
+// Usage: parallel_to_chars [harness options] [max threads]
+//
+// The results include the cost of starting the threads and of copying the text of each
+// slice into the output.
+
+#include <boost/charconv/parallel.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr std::size_t N = 2'000'000;
+
+static std::vector<double> random_values()
+{
+    std::vector<double> data;
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( std::isfinite( x ) ) data.push_back( x );
+    }
+
+    return data;
+}
+
+static std::size_t serial_format( std::vector<double> const& values, std::vector<char>& out )
+{
+    char* first = out.data();
+    char* last = first + out.size();
+
+    for( std::size_t i = 0; i < values.size(); ++i )
+    {
+        if( i != 0 ) *first++ = '\n';
+
+        auto r = boost::charconv::to_chars( first, last, values[ i ] );
+
+        if( !r ) break;
+
+        first = r.ptr;
+    }
+
+    return static_cast<std::size_t>( first - out.data() );
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( h.args().size() > 1 )
+    {
+        std::fprintf( stderr, "Usage: %s [harness options] [max threads]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    unsigned max_threads = std::thread::hardware_concurrency();
+
+    if( h.args().size() == 1 )
+    {
+        auto const& arg = h.args()[ 0 ];
+        auto r = boost::charconv::from_chars( arg.data(), arg.data() + arg.size(), max_threads );
+
+        if( !r || r.ptr != arg.data() + arg.size() || max_threads == 0 )
+        {
+            std::fprintf( stderr, "Invalid number of threads: %s\n", arg.c_str() );
+            return 2;
+        }
+    }
+
+    if( max_threads == 0 ) max_threads = 1;
+
+    std::vector<unsigned> thread_counts;
+
+    for( unsigned t = 1; t < max_threads; t *= 2 ) thread_counts.push_back( t );
+    thread_counts.push_back( max_threads );
+
+    std::vector<double> const values = random_values();
+
+    // Sized as a caller that does not know the values would size it
+    std::vector<char> out( N * ( boost::charconv::limits<double>::max_chars + 1 ) );
+
+    h.run( "to_chars loop", N, [&]{ return serial_format( values, out ); } );
+
+    if( h.results().empty() ) return h.finish();
+
+    double const base = h.results().back().median_ns;
+
+    std::vector<double> times;
+
+    for( unsigned threads: thread_counts )
+    {
+        std::size_t const before = h.results().size();
+
+        h.run( "parallel_to_chars, " + std::to_string( threads ) + ( threads == 1? " thread": " threads" ), N, [&]{
+
+            auto r = boost::charconv::parallel_to_chars( out.data(), out.data() + out.size(), values.data(), values.data() + values.size(), '\n', threads );
+
+            return static_cast<std::size_t>( r.ptr - out.data() );
+        });
+
+        times.push_back( h.results().size() == before? 0: h.results().back().median_ns );
+    }
+
+    std::printf( "%-52s %7s %10s %10s %10s\n", "", "threads", "Mconv/s", "speedup", "efficiency" );
+
+    for( std::size_t i = 0; i < thread_counts.size(); ++i )
+    {
+        if( times[ i ] == 0 ) continue;
+
+        double const speedup = base / times[ i ];
+
+        std::printf( "%-52s %7u %10.1f %9.2fx %9.1f%%\n", "", thread_counts[ i ], 1e3 / times[ i ], speedup, speedup / thread_counts[ i ] * 100 );
+    }
+
+    std::printf( "\n" );
+
+    return h.finish();
+}
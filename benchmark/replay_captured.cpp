@@ -0,0 +1,189 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Replays the inputs written by boost::charconv::drain_captured_inputs
+// Usage: replay_captured [harness options] <capture file>
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/config.hpp>
+#include "harness.hpp"
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// The captures hold at most a few hundred records per thread, so each sample replays them K times
+constexpr int K = 100;
+
+template<class T> struct value_record
+{
+    T value;
+    boost::charconv::chars_format fmt;
+    int precision;
+};
+
+template<class T> struct replay_data
+{
+    std::vector<std::string> inputs;
+    std::vector<value_record<T>> values;
+};
+
+static boost::charconv::chars_format parse_format( std::string const& name )
+{
+    if( name == "scientific" ) return boost::charconv::chars_format::scientific;
+    if( name == "fixed" ) return boost::charconv::chars_format::fixed;
+    if( name == "hex" ) return boost::charconv::chars_format::hex;
+    return boost::charconv::chars_format::general;
+}
+
+// The value is stored as its bytes in memory order
+template<class T> static bool parse_value( std::string const& hex, T& value )
+{
+    if( hex.size() != 2 + 2 * sizeof( T ) || hex.compare( 0, 2, "0x" ) != 0 ) return false;
+
+    unsigned char bytes[ sizeof( T ) ];
+
+    for( std::size_t i = 0; i < sizeof( T ); ++i )
+    {
+        std::uint8_t byte = 0;
+        auto r = boost::charconv::from_chars( hex.data() + 2 + 2 * i, hex.data() + 4 + 2 * i, byte, 16 );
+        if( !r ) return false;
+        bytes[ i ] = byte;
+    }
+
+    std::memcpy( &value, bytes, sizeof( T ) );
+    return true;
+}
+
+template<class T> static void add_record( replay_data<T>& data, std::string const& kind, std::istringstream& line )
+{
+    std::string payload;
+    line >> payload;
+
+    if( kind == "printf" )
+    {
+        std::string fmt;
+        int precision = -1;
+        line >> fmt >> precision;
+
+        T value;
+        if( parse_value( payload, value ) )
+        {
+            data.values.push_back( { value, parse_format( fmt ), precision } );
+        }
+    }
+    else
+    {
+        data.inputs.push_back( payload );
+    }
+}
+
+template<class T> static BOOST_NOINLINE void test_boost_from_chars( bench::harness& h, std::vector<std::string> const& data )
+{
+    if( data.empty() ) return;
+
+    h.run( "boost::charconv::from_chars<" + boost::core::type_name<T>() + ">, " + std::to_string( data.size() ) + " inputs", data.size() * K, [&]{
+
+        long double s = 0;
+        std::size_t n = 0;
+
+        for( int i = 0; i < K; ++i )
+        {
+            for( auto const& x: data )
+            {
+                T y {};
+                auto r = boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+
+                s = s / 16.0L + y;
+                n += static_cast<std::size_t>( r.ptr - x.data() );
+            }
+        }
+
+        bench::do_not_optimize( s );
+        return n;
+    });
+}
+
+template<class T> static BOOST_NOINLINE void test_boost_to_chars( bench::harness& h, std::vector<value_record<T>> const& data )
+{
+    if( data.empty() ) return;
+
+    h.run( "boost::charconv::to_chars<" + boost::core::type_name<T>() + ">, " + std::to_string( data.size() ) + " values", data.size() * K, [&]{
+
+        std::size_t s = 0;
+
+        for( int i = 0; i < K; ++i )
+        {
+            for( auto const& x: data )
+            {
+                char buffer[ 8192 ];
+                auto r = x.precision == -1 ? boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x.value, x.fmt ) :
+                                             boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x.value, x.fmt, x.precision );
+                s += static_cast<std::size_t>( r.ptr - buffer );
+                bench::do_not_optimize( buffer );
+            }
+        }
+
+        return s;
+    });
+}
+
+template<class T> static void test( bench::harness& h, replay_data<T> const& data )
+{
+    test_boost_from_chars<T>( h, data.inputs );
+    test_boost_to_chars<T>( h, data.values );
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( h.args().size() != 1 )
+    {
+        std::fprintf( stderr, "Usage: %s [harness options] <capture file>\n", argv[ 0 ] );
+        return 2;
+    }
+
+    std::ifstream file( h.args()[ 0 ] );
+    if( !file )
+    {
+        std::fprintf( stderr, "Unable to open %s\n", h.args()[ 0 ].c_str() );
+        return 1;
+    }
+
+    replay_data<float> floats;
+    replay_data<double> doubles;
+    replay_data<long double> long_doubles;
+    std::size_t skipped = 0;
+
+    std::string text;
+    while( std::getline( file, text ) )
+    {
+        std::istringstream line( text );
+        std::string kind, type;
+        line >> kind >> type;
+
+        if( type == "float" ) add_record( floats, kind, line );
+        else if( type == "double" ) add_record( doubles, kind, line );
+        else if( type == "long_double" ) add_record( long_doubles, kind, line );
+        else ++skipped;
+    }
+
+    if( skipped != 0 )
+    {
+        std::printf( "Skipped %zu records of unsupported types\n\n", skipped );
+    }
+
+    test( h, floats );
+    test( h, doubles );
+    test( h, long_doubles );
+
+    return h.finish();
+}
@@ -0,0 +1,436 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Runs the same conversions on 1, 2, 4, ... threads at once and reports how the throughput scales.
+// Usage: scaling [harness options] [max threads] [min efficiency in percent]
+//
+// Every thread converts the same number of values, so with perfect scaling the wall time
+// does not depend on the number of threads. Shared tables are only read, so anything below
+// full efficiency points to shared state on the hot path (a lock in malloc or localeconv in
+// a fallback, cache lines written by several threads), or to a shared resource of the machine
+// such as memory bandwidth or the clock boost of a single core.
+//
+// On Linux the threads are pinned to the CPUs the process may run on, in order.
+// With a minimum efficiency the exit code is 1 if any measurement is below it.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/config.hpp>
+#include "harness.hpp"
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Values converted by each thread per sample
+constexpr unsigned N = 10'000;
+constexpr int K = 10;
+
+// Threads that wait for a job and run it on the first n of them
+class thread_pool
+{
+public:
+
+    explicit thread_pool( unsigned threads )
+    {
+        std::vector<std::size_t> const cpus = available_cpus();
+
+        for( unsigned i = 0; i < threads; ++i )
+        {
+            threads_.emplace_back( [this, i]{ work( i ); } );
+
+            if( !cpus.empty() && !pin( threads_.back(), cpus[ i % cpus.size() ] ) )
+            {
+                pinned_ = false;
+            }
+        }
+
+        if( cpus.empty() ) pinned_ = false;
+
+        cpus_ = cpus.size();
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            stop_ = true;
+        }
+
+        start_.notify_all();
+
+        for( auto& t: threads_ ) t.join();
+    }
+
+    thread_pool( thread_pool const& ) = delete;
+    thread_pool& operator=( thread_pool const& ) = delete;
+
+    bool pinned() const noexcept
+    {
+        return pinned_;
+    }
+
+    // The number of CPUs the process may run on, 0 if unknown
+    std::size_t cpus() const noexcept
+    {
+        return cpus_;
+    }
+
+    // Runs job( i ) for i in [0, n) on threads 0 to n - 1 and waits for all of them
+    void run( unsigned n, std::function<void( unsigned )> job )
+    {
+        std::unique_lock<std::mutex> lock( mutex_ );
+
+        job_ = std::move( job );
+        active_ = n;
+        pending_ = n;
+        ++generation_;
+
+        start_.notify_all();
+        done_.wait( lock, [&]{ return pending_ == 0; } );
+    }
+
+private:
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    std::function<void( unsigned )> job_;
+
+    unsigned active_ = 0;
+    unsigned pending_ = 0;
+    unsigned generation_ = 0;
+    std::size_t cpus_ = 0;
+    bool stop_ = false;
+    bool pinned_ = true;
+
+    void work( unsigned i )
+    {
+        unsigned seen = 0;
+
+        for( ;; )
+        {
+            std::unique_lock<std::mutex> lock( mutex_ );
+            start_.wait( lock, [&]{ return stop_ || generation_ != seen; } );
+
+            if( stop_ ) return;
+
+            seen = generation_;
+            if( i >= active_ ) continue;
+
+            lock.unlock();
+            job_( i );
+            lock.lock();
+
+            if( --pending_ == 0 ) done_.notify_one();
+        }
+    }
+
+#if defined(__linux__)
+
+    static std::vector<std::size_t> available_cpus()
+    {
+        std::vector<std::size_t> cpus;
+
+        cpu_set_t set;
+        CPU_ZERO( &set );
+
+        if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 )
+        {
+            for( std::size_t i = 0; i < CPU_SETSIZE; ++i )
+            {
+                if( CPU_ISSET( i, &set ) ) cpus.push_back( i );
+            }
+        }
+
+        return cpus;
+    }
+
+    static bool pin( std::thread& t, std::size_t cpu )
+    {
+        cpu_set_t set;
+        CPU_ZERO( &set );
+        CPU_SET( cpu, &set );
+
+        return pthread_setaffinity_np( t.native_handle(), sizeof( set ), &set ) == 0;
+    }
+
+#else
+
+    static std::vector<std::size_t> available_cpus()
+    {
+        return {};
+    }
+
+    static bool pin( std::thread&, std::size_t )
+    {
+        return false;
+    }
+
+#endif
+};
+
+// Per thread result, on its own cache line so that the benchmark does not share any
+struct alignas( 64 ) slot
+{
+    std::size_t value = 0;
+};
+
+struct measurement
+{
+    unsigned threads;
+    double ns_per_op;
+};
+
+template<class T> static std::function<std::size_t()> from_chars_job( std::vector<std::string> const& data )
+{
+    return [&data]{
+
+        std::size_t n = 0;
+
+        for( int i = 0; i < K; ++i )
+        {
+            for( auto const& x: data )
+            {
+                T y;
+                auto r = boost::charconv::from_chars( x.data(), x.data() + x.size(), y );
+
+                bench::do_not_optimize( y );
+                n += static_cast<std::size_t>( r.ptr - x.data() );
+            }
+        }
+
+        return n;
+    };
+}
+
+template<class T> static std::function<std::size_t()> to_chars_job( std::vector<T> const& data, boost::charconv::chars_format fmt, int precision = -1 )
+{
+    return [&data, fmt, precision]{
+
+        std::size_t n = 0;
+
+        for( int i = 0; i < K; ++i )
+        {
+            for( T x: data )
+            {
+                char buffer[ 256 ];
+                auto r = precision == -1? boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
+                                          boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
+
+                bench::do_not_optimize( buffer );
+                n += static_cast<std::size_t>( r.ptr - buffer );
+            }
+        }
+
+        return n;
+    };
+}
+
+static std::function<std::size_t()> to_chars_job( std::vector<std::uint64_t> const& data )
+{
+    return [&data]{
+
+        std::size_t n = 0;
+
+        for( int i = 0; i < K; ++i )
+        {
+            for( std::uint64_t x: data )
+            {
+                char buffer[ 32 ];
+                auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+
+                bench::do_not_optimize( buffer );
+                n += static_cast<std::size_t>( r.ptr - buffer );
+            }
+        }
+
+        return n;
+    };
+}
+
+class scaling_test
+{
+public:
+
+    scaling_test( bench::harness& h, thread_pool& pool, std::vector<unsigned> const& thread_counts ): h_( h ), pool_( pool ), thread_counts_( thread_counts )
+    {
+    }
+
+    // Returns the lowest efficiency, or 1 if nothing was measured
+    double run( std::string const& name, std::function<std::size_t()> job )
+    {
+        std::vector<measurement> measurements;
+
+        for( unsigned threads: thread_counts_ )
+        {
+            std::size_t const before = h_.results().size();
+
+            h_.run( name + ", " + std::to_string( threads ) + ( threads == 1? " thread": " threads" ), std::size_t( threads ) * N * K, [&]{
+
+                std::vector<slot> slots( threads );
+
+                pool_.run( threads, [&]( unsigned i ){ slots[ i ].value = job(); } );
+
+                std::size_t n = 0;
+                for( auto const& s: slots ) n += s.value;
+
+                return n;
+            });
+
+            if( h_.results().size() == before ) return 1;
+
+            measurements.push_back( { threads, h_.results().back().median_ns } );
+        }
+
+        return report( measurements );
+    }
+
+private:
+
+    bench::harness& h_;
+    thread_pool& pool_;
+    std::vector<unsigned> thread_counts_;
+
+    // With perfect scaling the time per conversion is that of one thread divided by the number of threads
+    static double report( std::vector<measurement> const& measurements )
+    {
+        double const base = measurements.front().ns_per_op;
+        double lowest = 1;
+
+        std::printf( "%-52s %7s %10s %10s %10s\n", "", "threads", "Mconv/s", "speedup", "efficiency" );
+
+        for( auto const& m: measurements )
+        {
+            double const speedup = base / m.ns_per_op;
+            double const efficiency = speedup / m.threads;
+
+            std::printf( "%-52s %7u %10.1f %9.2fx %9.1f%%\n", "", m.threads, 1e3 / m.ns_per_op, speedup, efficiency * 100 );
+
+            if( efficiency < lowest ) lowest = efficiency;
+        }
+
+        std::printf( "\n" );
+        std::fflush( stdout );
+
+        return lowest;
+    }
+};
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( h.args().size() > 2 )
+    {
+        std::fprintf( stderr, "Usage: %s [harness options] [max threads] [min efficiency in percent]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    unsigned max_threads = std::thread::hardware_concurrency();
+    double min_efficiency = 0;
+
+    if( h.args().size() >= 1 )
+    {
+        auto const& arg = h.args()[ 0 ];
+        auto r = boost::charconv::from_chars( arg.data(), arg.data() + arg.size(), max_threads );
+
+        if( !r || r.ptr != arg.data() + arg.size() || max_threads == 0 )
+        {
+            std::fprintf( stderr, "Invalid number of threads: %s\n", arg.c_str() );
+            return 2;
+        }
+    }
+
+    if( h.args().size() == 2 )
+    {
+        auto const& arg = h.args()[ 1 ];
+        auto r = boost::charconv::from_chars( arg.data(), arg.data() + arg.size(), min_efficiency );
+
+        if( !r || r.ptr != arg.data() + arg.size() || min_efficiency < 0 || min_efficiency > 100 )
+        {
+            std::fprintf( stderr, "Invalid efficiency: %s\n", arg.c_str() );
+            return 2;
+        }
+    }
+
+    if( max_threads == 0 ) max_threads = 1;
+
+    std::vector<unsigned> thread_counts;
+
+    for( unsigned t = 1; t < max_threads; t *= 2 ) thread_counts.push_back( t );
+    thread_counts.push_back( max_threads );
+
+    thread_pool pool( max_threads );
+
+    if( !pool.pinned() )
+    {
+        std::printf( "The threads are not pinned to CPUs\n\n" );
+    }
+
+    if( pool.cpus() != 0 && max_threads > pool.cpus() )
+    {
+        std::printf( "%u threads on %zu CPUs, the measurements with more threads than CPUs can not scale\n\n", max_threads, pool.cpus() );
+    }
+
+    auto const integers = bench::random_values<std::uint64_t>( N );
+    auto const floats = bench::random_values<float>( N );
+    auto const doubles = bench::random_values<double>( N );
+    auto const long_doubles = bench::random_values<long double>( N );
+
+    auto const integer_strings = bench::shortest_strings( integers );
+    auto const float_strings = bench::shortest_strings( floats );
+    auto const double_strings = bench::shortest_strings( doubles );
+    auto const halfway = bench::halfway_strings( N );
+    auto const long_double_strings = bench::shortest_strings( long_doubles );
+
+    scaling_test test( h, pool, thread_counts );
+
+    std::string const uint64 = boost::core::type_name<std::uint64_t>();
+    std::string const f = boost::core::type_name<float>();
+    std::string const d = boost::core::type_name<double>();
+    std::string const ld = boost::core::type_name<long double>();
+
+    double const lowest = std::min( {
+
+        test.run( "boost::charconv::from_chars<" + uint64 + ">", from_chars_job<std::uint64_t>( integer_strings ) ),
+        test.run( "boost::charconv::from_chars<" + f + ">, shortest", from_chars_job<float>( float_strings ) ),
+        test.run( "boost::charconv::from_chars<" + d + ">, shortest", from_chars_job<double>( double_strings ) ),
+        test.run( "boost::charconv::from_chars<" + d + ">, 25 digits near halfway", from_chars_job<double>( halfway ) ),
+        test.run( "boost::charconv::from_chars<" + ld + ">, shortest", from_chars_job<long double>( long_double_strings ) ),
+
+        test.run( "boost::charconv::to_chars<" + uint64 + ">", to_chars_job( integers ) ),
+        test.run( "boost::charconv::to_chars<" + f + ">, shortest", to_chars_job( floats, boost::charconv::chars_format::general ) ),
+        test.run( "boost::charconv::to_chars<" + d + ">, shortest", to_chars_job( doubles, boost::charconv::chars_format::general ) ),
+        test.run( "boost::charconv::to_chars<" + d + ">, scientific, 50", to_chars_job( doubles, boost::charconv::chars_format::scientific, 50 ) ),
+        test.run( "boost::charconv::to_chars<" + ld + ">, shortest", to_chars_job( long_doubles, boost::charconv::chars_format::general ) ),
+    });
+
+    int const status = h.finish();
+    if( status != 0 ) return status;
+
+    if( lowest * 100 < min_efficiency )
+    {
+        std::printf( "Lowest efficiency %.1f%% is below %.1f%%\n", lowest * 100, min_efficiency );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The integer conversions are templates in the headers and do not need the compiled library.
+// This translation unit instantiates all of them so that size_report can measure what a
+// program using only the header-only part of Boost.Charconv pays for.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+
+namespace size_header_only
+{
+
+template<class T> boost::charconv::from_chars_result parse( char const* first, char const* last, T& value, int base )
+{
+    return boost::charconv::from_chars( first, last, value, base );
+}
+
+template<class T> boost::charconv::to_chars_result format( char* first, char* last, T value, int base )
+{
+    return boost::charconv::to_chars( first, last, value, base );
+}
+
+#define BOOST_CHARCONV_SIZE_INSTANTIATE(T) \
+    template boost::charconv::from_chars_result parse<T>( char const*, char const*, T&, int ); \
+    template boost::charconv::to_chars_result format<T>( char*, char*, T, int );
+
+BOOST_CHARCONV_SIZE_INSTANTIATE(char)
+BOOST_CHARCONV_SIZE_INSTANTIATE(signed char)
+BOOST_CHARCONV_SIZE_INSTANTIATE(unsigned char)
+BOOST_CHARCONV_SIZE_INSTANTIATE(short)
+BOOST_CHARCONV_SIZE_INSTANTIATE(unsigned short)
+BOOST_CHARCONV_SIZE_INSTANTIATE(int)
+BOOST_CHARCONV_SIZE_INSTANTIATE(unsigned)
+BOOST_CHARCONV_SIZE_INSTANTIATE(long)
+BOOST_CHARCONV_SIZE_INSTANTIATE(unsigned long)
+BOOST_CHARCONV_SIZE_INSTANTIATE(long long)
+BOOST_CHARCONV_SIZE_INSTANTIATE(unsigned long long)
+
+#undef BOOST_CHARCONV_SIZE_INSTANTIATE
+
+} // namespace size_header_only
@@ -0,0 +1,401 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Reports the code and table footprint of object files built in several configurations
+// Usage: size_report [--json <file>] [--top <n>] --config <name> <object>... [--config <name> <object>...]
+//
+// For every object the allocated sections are summed up as text, rodata, data and bss.
+// The largest functions and variables of each configuration are listed as well; symbols in
+// COMDAT sections (inline variables, template instantiations) are counted once, since the
+// linker keeps a single copy. Only ELF objects are understood.
+//
+// The JSON output is written one object or symbol per line and in a stable order, so that
+// the reports of two commits can be compared with diff.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/config.hpp>
+#include "harness.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__has_include)
+# if __has_include(<cxxabi.h>)
+#  include <cxxabi.h>
+#  include <cstdlib>
+#  define BOOST_CHARCONV_SIZE_REPORT_DEMANGLE
+# endif
+#endif
+
+namespace elf
+{
+
+// The subset of the ELF64 layout that is needed to walk sections and symbols
+
+struct header
+{
+    unsigned char ident[ 16 ];
+    std::uint16_t type;
+    std::uint16_t machine;
+    std::uint32_t version;
+    std::uint64_t entry;
+    std::uint64_t phoff;
+    std::uint64_t shoff;
+    std::uint32_t flags;
+    std::uint16_t ehsize;
+    std::uint16_t phentsize;
+    std::uint16_t phnum;
+    std::uint16_t shentsize;
+    std::uint16_t shnum;
+    std::uint16_t shstrndx;
+};
+
+struct section_header
+{
+    std::uint32_t name;
+    std::uint32_t type;
+    std::uint64_t flags;
+    std::uint64_t addr;
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::uint32_t link;
+    std::uint32_t info;
+    std::uint64_t addralign;
+    std::uint64_t entsize;
+};
+
+struct symbol
+{
+    std::uint32_t name;
+    unsigned char info;
+    unsigned char other;
+    std::uint16_t shndx;
+    std::uint64_t value;
+    std::uint64_t size;
+};
+
+constexpr std::uint32_t sht_symtab = 2;
+constexpr std::uint32_t sht_nobits = 8;
+constexpr std::uint64_t shf_alloc = 2;
+constexpr std::uint64_t shf_group = 0x200;
+constexpr std::uint16_t shn_loreserve = 0xff00;
+constexpr unsigned stt_object = 1;
+constexpr unsigned stt_func = 2;
+
+} // namespace elf
+
+enum section_class { text, rodata, data, bss, other };
+
+static char const* const class_names[] = { "text", "rodata", "data", "bss" };
+
+static bool starts_with( char const* s, char const* prefix )
+{
+    return std::strncmp( s, prefix, std::strlen( prefix ) ) == 0;
+}
+
+static section_class classify( elf::section_header const& sh, char const* name )
+{
+    if( !( sh.flags & elf::shf_alloc ) ) return other;
+    if( sh.type == elf::sht_nobits ) return bss;
+    if( starts_with( name, ".text" ) ) return text;
+    if( starts_with( name, ".rodata" ) ) return rodata;
+    if( starts_with( name, ".data" ) ) return data;
+    return other;
+}
+
+struct symbol_info
+{
+    std::string name;
+    section_class cls;
+    std::uint64_t size;
+};
+
+struct object_info
+{
+    std::string name;
+    std::uint64_t size[ 4 ] = {};
+
+    // Symbols in COMDAT groups, keyed by name so that they can be merged across objects
+    std::vector<symbol_info> shared;
+    std::vector<symbol_info> local;
+};
+
+static std::string demangle( char const* name )
+{
+#if defined(BOOST_CHARCONV_SIZE_REPORT_DEMANGLE)
+
+    int status = 0;
+    char* p = abi::__cxa_demangle( name, nullptr, nullptr, &status );
+
+    if( p != nullptr )
+    {
+        std::string r( p );
+        std::free( p );
+        return r;
+    }
+
+#endif
+
+    return name;
+}
+
+template<class T> static bool read_at( std::string const& file, std::uint64_t offset, T& out )
+{
+    if( offset > file.size() || file.size() - offset < sizeof( T ) ) return false;
+    std::memcpy( &out, file.data() + offset, sizeof( T ) );
+    return true;
+}
+
+static char const* string_at( std::string const& file, elf::section_header const& strtab, std::uint32_t index )
+{
+    if( strtab.offset > file.size() || index >= strtab.size || file.size() - strtab.offset <= index ) return "";
+    return file.data() + strtab.offset + index;
+}
+
+static bool load_object( char const* path, object_info& out )
+{
+    std::ifstream f( path, std::ios::binary );
+
+    if( !f )
+    {
+        std::fprintf( stderr, "Unable to open %s\n", path );
+        return false;
+    }
+
+    std::ostringstream ss;
+    ss << f.rdbuf();
+    std::string const file = ss.str();
+
+    elf::header h;
+
+    // 64 bit, little endian
+    if( !read_at( file, 0, h ) || std::memcmp( h.ident, "\x7f" "ELF", 4 ) != 0 || h.ident[ 4 ] != 2 || h.ident[ 5 ] != 1 || h.shentsize != sizeof( elf::section_header ) )
+    {
+        std::fprintf( stderr, "%s is not a 64 bit little endian ELF object\n", path );
+        return false;
+    }
+
+    std::vector<elf::section_header> sections( h.shnum );
+
+    for( std::size_t i = 0; i < sections.size(); ++i )
+    {
+        if( !read_at( file, h.shoff + i * sizeof( elf::section_header ), sections[ i ] ) )
+        {
+            std::fprintf( stderr, "%s: truncated section table\n", path );
+            return false;
+        }
+    }
+
+    if( h.shstrndx >= sections.size() )
+    {
+        std::fprintf( stderr, "%s: no section names\n", path );
+        return false;
+    }
+
+    std::vector<section_class> classes( sections.size() );
+
+    for( std::size_t i = 0; i < sections.size(); ++i )
+    {
+        classes[ i ] = classify( sections[ i ], string_at( file, sections[ h.shstrndx ], sections[ i ].name ) );
+        if( classes[ i ] != other ) out.size[ classes[ i ] ] += sections[ i ].size;
+    }
+
+    char const* slash = std::strrchr( path, '/' );
+    out.name = slash? slash + 1: path;
+
+    for( auto const& st: sections )
+    {
+        if( st.type != elf::sht_symtab || st.link >= sections.size() ) continue;
+
+        for( std::uint64_t offset = 0; offset + sizeof( elf::symbol ) <= st.size; offset += sizeof( elf::symbol ) )
+        {
+            elf::symbol sym;
+            if( !read_at( file, st.offset + offset, sym ) ) break;
+
+            unsigned const type = sym.info & 0xf;
+
+            if( ( type != elf::stt_object && type != elf::stt_func ) || sym.size == 0 ) continue;
+            if( sym.shndx == 0 || sym.shndx >= elf::shn_loreserve || sym.shndx >= sections.size() ) continue;
+            if( classes[ sym.shndx ] == other ) continue;
+
+            symbol_info info{ demangle( string_at( file, sections[ st.link ], sym.name ) ), classes[ sym.shndx ], sym.size };
+            ( sections[ sym.shndx ].flags & elf::shf_group? out.shared: out.local ).push_back( std::move( info ) );
+        }
+    }
+
+    return true;
+}
+
+struct configuration
+{
+    std::string name;
+    std::vector<object_info> objects;
+
+    std::uint64_t total[ 4 ] = {};
+    std::vector<symbol_info> symbols;
+};
+
+static void summarize( configuration& c )
+{
+    std::map<std::string, symbol_info> shared;
+
+    for( auto const& o: c.objects )
+    {
+        for( int i = 0; i < 4; ++i ) c.total[ i ] += o.size[ i ];
+        for( auto const& s: o.local ) c.symbols.push_back( s );
+        for( auto const& s: o.shared ) shared.emplace( s.name, s );
+    }
+
+    for( auto const& s: shared ) c.symbols.push_back( s.second );
+
+    std::sort( c.symbols.begin(), c.symbols.end(), []( symbol_info const& a, symbol_info const& b ){
+
+        return a.size != b.size? a.size > b.size: a.name < b.name;
+    });
+}
+
+static void print( std::vector<configuration> const& configs, std::size_t top )
+{
+    for( auto const& c: configs )
+    {
+        std::printf( "%s\n\n%-40s %10s %10s %10s %10s\n", c.name.c_str(), "object", "text", "rodata", "data", "bss" );
+
+        for( auto const& o: c.objects )
+        {
+            std::printf( "%-40s %10llu %10llu %10llu %10llu\n", o.name.c_str(), (unsigned long long)o.size[ text ],
+                (unsigned long long)o.size[ rodata ], (unsigned long long)o.size[ data ], (unsigned long long)o.size[ bss ] );
+        }
+
+        std::printf( "%-40s %10llu %10llu %10llu %10llu\n\n", "total", (unsigned long long)c.total[ text ],
+            (unsigned long long)c.total[ rodata ], (unsigned long long)c.total[ data ], (unsigned long long)c.total[ bss ] );
+
+        for( std::size_t i = 0; i < c.symbols.size() && i < top; ++i )
+        {
+            auto const& s = c.symbols[ i ];
+            std::printf( "%10llu %-6s %s\n", (unsigned long long)s.size, class_names[ s.cls ], s.name.c_str() );
+        }
+
+        std::printf( "\n" );
+    }
+}
+
+static bool write_json( char const* path, std::vector<configuration> const& configs, std::size_t top )
+{
+    using bench::json_escape;
+
+    std::FILE* f = std::fopen( path, "w" );
+
+    if( f == nullptr )
+    {
+        std::fprintf( stderr, "Unable to write %s\n", path );
+        return false;
+    }
+
+    std::fprintf( f, "{\n  \"context\": {\n" );
+    std::fprintf( f, "    \"compiler\": \"%s\",\n", json_escape( BOOST_COMPILER ).c_str() );
+    std::fprintf( f, "    \"platform\": \"%s\",\n", json_escape( BOOST_PLATFORM ).c_str() );
+    std::fprintf( f, "    \"top\": %zu\n  },\n", top );
+    std::fprintf( f, "  \"configurations\": [" );
+
+    for( std::size_t i = 0; i < configs.size(); ++i )
+    {
+        auto const& c = configs[ i ];
+
+        std::fprintf( f, "%s\n    {\n      \"name\": \"%s\",\n      \"objects\": [", i == 0? "": ",", json_escape( c.name ).c_str() );
+
+        for( std::size_t j = 0; j < c.objects.size(); ++j )
+        {
+            auto const& o = c.objects[ j ];
+
+            std::fprintf( f, "%s\n        { \"name\": \"%s\", \"text\": %llu, \"rodata\": %llu, \"data\": %llu, \"bss\": %llu }", j == 0? "": ",",
+                json_escape( o.name ).c_str(), (unsigned long long)o.size[ text ], (unsigned long long)o.size[ rodata ],
+                (unsigned long long)o.size[ data ], (unsigned long long)o.size[ bss ] );
+        }
+
+        std::fprintf( f, "\n      ],\n      \"total\": { \"text\": %llu, \"rodata\": %llu, \"data\": %llu, \"bss\": %llu },\n      \"symbols\": [",
+            (unsigned long long)c.total[ text ], (unsigned long long)c.total[ rodata ], (unsigned long long)c.total[ data ], (unsigned long long)c.total[ bss ] );
+
+        for( std::size_t j = 0; j < c.symbols.size() && j < top; ++j )
+        {
+            auto const& s = c.symbols[ j ];
+
+            std::fprintf( f, "%s\n        { \"name\": \"%s\", \"section\": \"%s\", \"size\": %llu }", j == 0? "": ",",
+                json_escape( s.name ).c_str(), class_names[ s.cls ], (unsigned long long)s.size );
+        }
+
+        std::fprintf( f, "\n      ]\n    }" );
+    }
+
+    std::fprintf( f, "\n  ]\n}\n" );
+    std::fclose( f );
+
+    return true;
+}
+
+int main( int argc, char** argv )
+{
+    char const* json = nullptr;
+    std::size_t top = 25;
+    std::vector<configuration> configs;
+
+    for( int i = 1; i < argc; ++i )
+    {
+        std::string const arg = argv[ i ];
+
+        if( arg == "--json" && i + 1 < argc )
+        {
+            json = argv[ ++i ];
+        }
+        else if( arg == "--top" && i + 1 < argc )
+        {
+            ++i;
+            auto r = boost::charconv::from_chars( argv[ i ], argv[ i ] + std::strlen( argv[ i ] ), top );
+
+            if( !r || *r.ptr != '\0' )
+            {
+                std::fprintf( stderr, "Invalid --top: %s\n", argv[ i ] );
+                return 2;
+            }
+        }
+        else if( arg == "--config" && i + 1 < argc )
+        {
+            configs.emplace_back();
+            configs.back().name = argv[ ++i ];
+        }
+        else if( !configs.empty() && arg.compare( 0, 2, "--" ) != 0 )
+        {
+            configs.back().objects.emplace_back();
+            if( !load_object( argv[ i ], configs.back().objects.back() ) ) return 1;
+        }
+        else
+        {
+            std::fprintf( stderr, "Usage: %s [--json <file>] [--top <n>] --config <name> <object>... [--config <name> <object>...]\n", argv[ 0 ] );
+            return 2;
+        }
+    }
+
+    if( configs.empty() )
+    {
+        std::fprintf( stderr, "Usage: %s [--json <file>] [--top <n>] --config <name> <object>... [--config <name> <object>...]\n", argv[ 0 ] );
+        return 2;
+    }
+
+    for( auto& c: configs )
+    {
+        std::sort( c.objects.begin(), c.objects.end(), []( object_info const& a, object_info const& b ){ return a.name < b.name; } );
+        summarize( c );
+    }
+
+    print( configs, top );
+
+    if( json != nullptr && !write_json( json, configs, top ) ) return 1;
+
+    return 0;
+}
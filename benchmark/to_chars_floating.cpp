@@ -24,15 +24,16 @@ std::ostream& operator<<( std::ostream& os, std::float128_t v)
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/config.hpp>
+#include "harness.hpp"
 #include <type_traits>
-#include <chrono>
+#include <cmath>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <cstring>
+#include <string>
+#include <vector>
 #include <charconv>
 
 constexpr unsigned N = 2'000'000;
-constexpr int K = 10;
 
 template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& data )
 {
@@ -75,14 +76,13 @@ template<> BOOST_NOINLINE void init_input_data<std::float128_t>( std::vector<std
 }
 #endif
 
-using namespace std::chrono_literals;
-
-template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const& data, bool general, char const* label, int precision )
+template<class T> static std::string label( char const* function, char const* format, int precision )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    std::size_t s = 0;
+    return std::string( function ) + "<" + boost::core::type_name<T>() + ">, " + format + ", " + std::to_string( precision );
+}
 
+template<class T> static BOOST_NOINLINE void test_snprintf( bench::harness& h, std::vector<T> const& data, bool general, char const* kind, int precision )
+{
     char const* format = general? "%.*g": "%.*e";
 
     int prec = precision;
@@ -97,145 +97,136 @@ template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const
         }
     }
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 22 ];
+    h.run( label<T>( "std::snprintf", kind, precision ), data.size(), [&]{
+
+        std::size_t s = 0;
+        char buffer[ 32 ];
 
         for( auto x: data )
         {
             auto r = std::snprintf( buffer, sizeof( buffer ), format, prec, x );
-            s += r;
-            s += static_cast<unsigned char>( buffer[0] );
+            s += static_cast<std::size_t>( r );
+            bench::do_not_optimize( buffer );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::snprintf<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        return s;
+    });
 }
 
-template<class T> static BOOST_NOINLINE void test_std_to_chars( std::vector<T> const& data, bool general, char const* label, int precision )
+template<class T> static BOOST_NOINLINE void test_std_to_chars( bench::harness& h, std::vector<T> const& data, bool general, char const* kind, int precision )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    std::chars_format fmt = general? std::chars_format::general: std::chars_format::scientific;
 
-    std::size_t s = 0;
+    h.run( label<T>( "std::to_chars", kind, precision ), data.size(), [&]{
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 21 ];
+        std::size_t s = 0;
+        char buffer[ 64 ];
 
         for( auto x: data )
         {
-            std::chars_format fmt = general? std::chars_format::general: std::chars_format::scientific;
-
             auto r = precision == 0?
                      std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
                      std::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
 
             s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
+            bench::do_not_optimize( buffer );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::to_chars<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        return s;
+    });
 }
 
-template<class T> static BOOST_NOINLINE void test_boost_to_chars( std::vector<T> const& data, bool general, char const* label, int precision )
+template<class T> static BOOST_NOINLINE void test_boost_to_chars( bench::harness& h, std::vector<T> const& data, bool general, char const* kind, int precision )
 {
-    auto t1 = std::chrono::steady_clock::now();
+    boost::charconv::chars_format fmt = general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific;
 
-    std::size_t s = 0;
+    h.run( label<T>( "boost::charconv::to_chars", kind, precision ), data.size(), [&]{
 
-    for( int i = 0; i < K; ++i )
-    {
-        char buffer[ 21 ];
+        std::size_t s = 0;
+        char buffer[ 64 ];
 
         for( auto x: data )
         {
-            boost::charconv::chars_format fmt = general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific;
-
             auto r = precision == 0?
                      boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
                      boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
 
             s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
+            bench::do_not_optimize( buffer );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        return s;
+    });
 }
 
-template<class T> static void test()
+template<class T> static void test( bench::harness& h )
 {
     std::vector<T> data;
     init_input_data( data );
 
-    test_snprintf( data, false, "scientific", 0 );
-    test_std_to_chars( data, false, "scientific", 0 );
-    test_boost_to_chars( data, false, "scientific", 0 );
+    test_snprintf( h, data, false, "scientific", 0 );
+    test_std_to_chars( h, data, false, "scientific", 0 );
+    test_boost_to_chars( h, data, false, "scientific", 0 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 
-    test_snprintf( data, false, "scientific", 6 );
-    test_std_to_chars( data, false, "scientific", 6 );
-    test_boost_to_chars( data, false, "scientific", 6 );
+    test_snprintf( h, data, false, "scientific", 6 );
+    test_std_to_chars( h, data, false, "scientific", 6 );
+    test_boost_to_chars( h, data, false, "scientific", 6 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 
-    test_snprintf( data, true, "general", 0 );
-    test_std_to_chars( data, true, "general", 0 );
-    test_boost_to_chars( data, true, "general", 0 );
+    test_snprintf( h, data, true, "general", 0 );
+    test_std_to_chars( h, data, true, "general", 0 );
+    test_boost_to_chars( h, data, true, "general", 0 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 
-    test_snprintf( data, true, "general", 6 );
-    test_std_to_chars( data, true, "general", 6 );
-    test_boost_to_chars( data, true, "general", 6 );
+    test_snprintf( h, data, true, "general", 6 );
+    test_std_to_chars( h, data, true, "general", 6 );
+    test_boost_to_chars( h, data, true, "general", 6 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 }
 
 #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
-template<> void test<std::float128_t>()
+template<> void test<std::float128_t>( bench::harness& h )
 {
     std::vector<std::float128_t> data;
     init_input_data( data );
 
-    test_std_to_chars( data, false, "scientific", 0 );
-    test_boost_to_chars( data, false, "scientific", 0 );
+    test_std_to_chars( h, data, false, "scientific", 0 );
+    test_boost_to_chars( h, data, false, "scientific", 0 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 
-    test_std_to_chars( data, false, "scientific", 6 );
-    test_boost_to_chars( data, false, "scientific", 6 );
+    test_std_to_chars( h, data, false, "scientific", 6 );
+    test_boost_to_chars( h, data, false, "scientific", 6 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 
-    test_std_to_chars( data, true, "general", 0 );
-    test_boost_to_chars( data, true, "general", 0 );
+    test_std_to_chars( h, data, true, "general", 0 );
+    test_boost_to_chars( h, data, true, "general", 0 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 
-    test_std_to_chars( data, true, "general", 6 );
-    test_boost_to_chars( data, true, "general", 6 );
+    test_std_to_chars( h, data, true, "general", 6 );
+    test_boost_to_chars( h, data, true, "general", 6 );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 }
 #endif
 
-int main()
+int main( int argc, char** argv )
 {
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
 
-    test<float>();
-    test<double>();
+    test<float>( h );
+    test<double>( h );
     #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
-    test<std::float128_t>();
+    test<std::float128_t>( h );
     #endif
+
+    return h.finish();
 }
@@ -6,15 +6,14 @@
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/config.hpp>
+#include "harness.hpp"
 #include <type_traits>
-#include <chrono>
 #include <cstdio>
-#include <iostream>
-#include <iomanip>
+#include <string>
+#include <vector>
 #include <charconv>
 
 constexpr unsigned N = 2'000'000;
-constexpr int K = 10;
 
 template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& data )
 {
@@ -28,14 +27,8 @@ template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& da
     }
 }
 
-using namespace std::chrono_literals;
-
-template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const& data )
+template<class T> static BOOST_NOINLINE void test_snprintf( bench::harness& h, std::vector<T> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    std::size_t s = 0;
-
     char const* format = "%d";
 
     BOOST_IF_CONSTEXPR( std::is_same<T, unsigned>::value )
@@ -63,98 +56,89 @@ template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const
         format = "%llu";
     }
 
-    for( int i = 0; i < K; ++i )
-    {
+    h.run( "std::snprintf<" + boost::core::type_name<T>() + ">", data.size(), [&]{
+
+        std::size_t s = 0;
         char buffer[ 22 ];
 
         for( auto x: data )
         {
             auto r = std::snprintf( buffer, sizeof( buffer ), format, x );
-            s += r;
-            s += static_cast<unsigned char>( buffer[0] );
+            s += static_cast<std::size_t>( r );
+            bench::do_not_optimize( buffer );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::snprintf<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        return s;
+    });
 }
 
-template<class T> static BOOST_NOINLINE void test_std_to_chars( std::vector<T> const& data )
+template<class T> static BOOST_NOINLINE void test_std_to_chars( bench::harness& h, std::vector<T> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    std::size_t s = 0;
+    h.run( "std::to_chars<" + boost::core::type_name<T>() + ">", data.size(), [&]{
 
-    for( int i = 0; i < K; ++i )
-    {
+        std::size_t s = 0;
         char buffer[ 21 ];
 
         for( auto x: data )
         {
             auto r = std::to_chars( buffer, buffer + sizeof( buffer ), x );
             s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
+            bench::do_not_optimize( buffer );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "            std::to_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        return s;
+    });
 }
 
-template<class T> static BOOST_NOINLINE void test_boost_to_chars( std::vector<T> const& data )
+template<class T> static BOOST_NOINLINE void test_boost_to_chars( bench::harness& h, std::vector<T> const& data )
 {
-    auto t1 = std::chrono::steady_clock::now();
-
-    std::size_t s = 0;
+    h.run( "boost::charconv::to_chars<" + boost::core::type_name<T>() + ">", data.size(), [&]{
 
-    for( int i = 0; i < K; ++i )
-    {
+        std::size_t s = 0;
         char buffer[ 21 ];
 
         for( auto x: data )
         {
             auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
             s += static_cast<std::size_t>( r.ptr - buffer );
-            s += static_cast<unsigned char>( buffer[0] );
+            bench::do_not_optimize( buffer );
         }
-    }
 
-    auto t2 = std::chrono::steady_clock::now();
-
-    std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+        return s;
+    });
 }
 
-template<class T> static void test()
+template<class T> static void test( bench::harness& h )
 {
     std::vector<T> data;
     init_input_data( data );
 
-    test_snprintf( data );
-    test_std_to_chars( data );
-    test_boost_to_chars( data );
+    test_snprintf( h, data );
+    test_std_to_chars( h, data );
+    test_boost_to_chars( h, data );
 
-    std::cout << std::endl;
+    std::printf( "\n" );
 }
 
-int main()
+int main( int argc, char** argv )
 {
-    std::cout << BOOST_COMPILER << "\n";
-    std::cout << BOOST_STDLIB << "\n\n";
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    test<signed char>( h );
+    test<unsigned char>( h );
 
-    test<signed char>();
-    test<unsigned char>();
+    test<short>( h );
+    test<unsigned short>( h );
 
-    test<short>();
-    test<unsigned short>();
+    test<int>( h );
+    test<unsigned int>( h );
 
-    test<int>();
-    test<unsigned int>();
+    test<long>( h );
+    test<unsigned long>( h );
 
-    test<long>();
-    test<unsigned long>();
+    test<long long>( h );
+    test<unsigned long long>( h );
 
-    test<long long>();
-    test<unsigned long long>();
+    return h.finish();
 }
@@ -0,0 +1,126 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Writes an array of doubles as JSON, with non-finite values as null and integer values
+// with a ".0": by post-processing the text of to_chars, and with to_chars_json.
+// Results are in MB/s of JSON text.
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+constexpr std::size_t N = 1'000'000;
+
+// Random doubles, integers, prices, and one non-finite value in a hundred
+static std::vector<double> make_values()
+{
+    boost::detail::splitmix64 rng;
+    std::vector<double> values( N );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        switch( i % 4 )
+        {
+        case 0: std::memcpy( &values[ i ], &tmp, sizeof( double ) ); break;
+        case 1: values[ i ] = static_cast<double>( static_cast<std::int32_t>( tmp ) ); break;
+        case 2: values[ i ] = static_cast<double>( tmp % 1000000 ) / 100; break;
+        default: values[ i ] = tmp % 25 == 0? std::numeric_limits<double>::quiet_NaN(): static_cast<double>( tmp % 1000 ); break;
+        }
+    }
+
+    return values;
+}
+
+static std::size_t post_process( std::vector<double> const& values, std::string& out )
+{
+    char* p = &out[ 0 ];
+    char* const last = p + out.size();
+
+    *p++ = '[';
+
+    for( double x: values )
+    {
+        if( !std::isfinite( x ) )
+        {
+            std::memcpy( p, "null", 4 );
+            p += 4;
+        }
+        else
+        {
+            char* start = p;
+            p = boost::charconv::to_chars( p, last, x ).ptr;
+
+            bool integer = true;
+
+            for( char* q = start; q != p; ++q )
+            {
+                if( *q == '.' || *q == 'e' ) { integer = false; break; }
+            }
+
+            if( integer )
+            {
+                std::memcpy( p, ".0", 2 );
+                p += 2;
+            }
+        }
+
+        *p++ = ',';
+    }
+
+    p[ -1 ] = ']';
+    return static_cast<std::size_t>( p - out.data() );
+}
+
+static std::size_t direct( std::vector<double> const& values, std::string& out )
+{
+    boost::charconv::json_options options;
+    options.nonfinite = boost::charconv::json_nonfinite::null;
+    options.integer_fraction = true;
+
+    char* p = &out[ 0 ];
+    char* const last = p + out.size();
+
+    *p++ = '[';
+
+    for( double x: values )
+    {
+        p = boost::charconv::to_chars_json( p, last, x, options ).ptr;
+        *p++ = ',';
+    }
+
+    p[ -1 ] = ']';
+    return static_cast<std::size_t>( p - out.data() );
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    std::vector<double> const values = make_values();
+
+    std::string expected( N * 32, '\0' ), out( N * 32, '\0' );
+
+    std::size_t const n = post_process( values, expected );
+
+    if( direct( values, out ) != n || out.compare( 0, n, expected, 0, n ) != 0 )
+    {
+        std::fprintf( stderr, "The methods do not agree\n" );
+        return 1;
+    }
+
+    h.run( "to_chars + post-processing", N, [&]{ return post_process( values, out ); } );
+    h.run( "to_chars_json", N, [&]{ return direct( values, out ); } );
+
+    return h.finish();
+}
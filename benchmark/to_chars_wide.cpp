@@ -0,0 +1,104 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Writes doubles and int64 values as UTF-16 text separated by ',': by widening the output of the
+// char overloads of to_chars, and with the char16_t overloads of to_chars.
+// Results are in MB/s of UTF-16 text.
+
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include "harness.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr std::size_t N = 1'000'000;
+
+template<class T> static std::vector<T> make_values()
+{
+    boost::detail::splitmix64 rng;
+    std::vector<T> values;
+    values.reserve( N );
+
+    while( values.size() < N )
+    {
+        std::uint64_t tmp = rng();
+
+        T x;
+        std::memcpy( &x, &tmp, sizeof( x ) );
+
+        if( !std::isfinite( static_cast<double>( x ) ) ) continue;
+
+        values.push_back( x );
+    }
+
+    return values;
+}
+
+template<class T> static std::size_t to_chars_then_widen( std::vector<T> const& values, std::u16string& out )
+{
+    char16_t* p = &out[ 0 ];
+
+    for( T x: values )
+    {
+        char buffer[ 32 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+
+        for( char const* q = buffer; q != r.ptr; ++q )
+        {
+            *p++ = static_cast<char16_t>( *q );
+        }
+
+        *p++ = u',';
+    }
+
+    return static_cast<std::size_t>( p - out.data() ) * sizeof( char16_t );
+}
+
+template<class T> static std::size_t to_chars_wide( std::vector<T> const& values, std::u16string& out )
+{
+    char16_t* p = &out[ 0 ];
+    char16_t* const last = p + out.size();
+
+    for( T x: values )
+    {
+        p = boost::charconv::to_chars( p, last, x ).ptr;
+        *p++ = u',';
+    }
+
+    return static_cast<std::size_t>( p - out.data() ) * sizeof( char16_t );
+}
+
+template<class T> static bool run( bench::harness& h, char const* type )
+{
+    std::vector<T> const values = make_values<T>();
+
+    std::u16string expected( N * 32, u'\0' ), out( N * 32, u'\0' );
+
+    std::size_t const n = to_chars_then_widen( values, expected );
+
+    if( to_chars_wide( values, out ) != n || out.compare( 0, n / sizeof( char16_t ), expected, 0, n / sizeof( char16_t ) ) != 0 )
+    {
+        std::fprintf( stderr, "The methods do not agree for %s\n", type );
+        return false;
+    }
+
+    h.run( std::string( type ) + ", to_chars + widen", N, [&]{ return to_chars_then_widen( values, out ); } );
+    h.run( std::string( type ) + ", to_chars char16_t", N, [&]{ return to_chars_wide( values, out ); } );
+
+    return true;
+}
+
+int main( int argc, char** argv )
+{
+    bench::harness h( argc, argv );
+    if( !h.ok() ) return h.finish();
+
+    if( !run<double>( h, "double" ) || !run<std::int64_t>( h, "int64" ) ) return 1;
+
+    return h.finish();
+}
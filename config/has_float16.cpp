@@ -0,0 +1,15 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <stdfloat>
+
+#if !defined(__STDCPP_FLOAT16_T__)
+#  error "No std::float16_t"
+#endif
+
+int main()
+{
+    std::float16_t f = 2.0f16;
+    return static_cast<int>(f) - 2;
+}
@@ -8,5 +8,12 @@
 #include <boost/charconv/from_chars.hpp>
 #include <boost/charconv/to_chars.hpp>
 #include <boost/charconv/limits.hpp>
+#include <boost/charconv/stats.hpp>
+#include <boost/charconv/capture.hpp>
+#include <boost/charconv/scan_number.hpp>
+#include <boost/charconv/stream_parser.hpp>
+#include <boost/charconv/parallel.hpp>
+#include <boost/charconv/load_numbers.hpp>
+#include <boost/charconv/csv.hpp>
 
 #endif // #ifndef BOOST_CHARCONV_HPP_INCLUDED
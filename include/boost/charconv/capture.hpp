@@ -0,0 +1,29 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_CAPTURE_HPP_INCLUDED
+#define BOOST_CHARCONV_CAPTURE_HPP_INCLUDED
+
+#include <boost/charconv/config.hpp>
+#include <system_error>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+struct drain_result
+{
+    std::size_t records;
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+// Appends the slow path inputs captured on the calling thread to the file at path, and empties the buffer.
+// Inputs are only captured when the library is compiled with BOOST_CHARCONV_ENABLE_CAPTURE,
+// otherwise nothing is written and records is always 0.
+BOOST_CHARCONV_DECL drain_result drain_captured_inputs(const char* path) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_CAPTURE_HPP_INCLUDED
@@ -14,7 +14,11 @@ enum class chars_format : unsigned
     scientific = 1 << 0,
     fixed = 1 << 1,
     hex = 1 << 2,
-    general = fixed | scientific
+    general = fixed | scientific,
+
+    // general restricted to the number grammar of JSON (RFC 8259): no leading '+', no leading zeros,
+    // digits on both sides of the decimal point, and no inf or nan
+    json = 1 << 3 | general
 };
 
 }} // Namespaces
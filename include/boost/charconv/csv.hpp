@@ -0,0 +1,157 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_CSV_HPP_INCLUDED
+#define BOOST_CHARCONV_CSV_HPP_INCLUDED
+
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+enum class column_type : unsigned
+{
+    skip,
+    int64,
+    uint64,
+    float32,
+    float64
+};
+
+// One column of the schema, and the array its values are stored in.
+// The type of the column follows from the type of the array; a null pointer skips the column.
+struct csv_column
+{
+    column_type type;
+    void* values;
+
+    constexpr csv_column() noexcept : type(column_type::skip), values(nullptr) {}
+    constexpr csv_column(std::nullptr_t) noexcept : type(column_type::skip), values(nullptr) {}
+    constexpr csv_column(std::int64_t* v) noexcept : type(column_type::int64), values(v) {}
+    constexpr csv_column(std::uint64_t* v) noexcept : type(column_type::uint64), values(v) {}
+    constexpr csv_column(float* v) noexcept : type(column_type::float32), values(v) {}
+    constexpr csv_column(double* v) noexcept : type(column_type::float64), values(v) {}
+};
+
+struct csv_options
+{
+    char delimiter = ',';
+    char quote = '"';
+    bool header = false; // The first line holds the names of the columns and is skipped
+    chars_format fmt = chars_format::general;
+};
+
+struct csv_result
+{
+    const char* ptr;    // The first row that was not stored, or where the field that failed went wrong
+    std::size_t rows;   // Number of rows stored, which is also the index of the row that failed
+    std::size_t column; // Index of the column that failed
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+// Parses the rows of [first, last) into the arrays of columns, which must have room for max_rows values.
+// A file with more rows stops after max_rows of them with std::errc::value_too_large, and ptr
+// pointing to the next row, so that large inputs can be parsed in batches.
+BOOST_CHARCONV_DECL csv_result parse_csv(const char* first, const char* last, const csv_column* columns, std::size_t column_count,
+                                         std::size_t max_rows, const csv_options& options = csv_options()) noexcept;
+
+template <std::size_t N>
+inline csv_result parse_csv(const char* first, const char* last, const csv_column (&columns)[N],
+                            std::size_t max_rows, const csv_options& options = csv_options()) noexcept
+{
+    return parse_csv(first, last, columns, N, max_rows, options);
+}
+
+// One column of a table to write, and the array its values are read from.
+// A null pointer writes an empty field.
+struct const_csv_column
+{
+    column_type type;
+    const void* values;
+
+    constexpr const_csv_column() noexcept : type(column_type::skip), values(nullptr) {}
+    constexpr const_csv_column(std::nullptr_t) noexcept : type(column_type::skip), values(nullptr) {}
+    constexpr const_csv_column(const std::int64_t* v) noexcept : type(column_type::int64), values(v) {}
+    constexpr const_csv_column(const std::uint64_t* v) noexcept : type(column_type::uint64), values(v) {}
+    constexpr const_csv_column(const float* v) noexcept : type(column_type::float32), values(v) {}
+    constexpr const_csv_column(const double* v) noexcept : type(column_type::float64), values(v) {}
+};
+
+struct csv_write_options
+{
+    char delimiter = ',';
+    char quote = '"';   // Encloses the names of write_header that need it
+    bool crlf = false;  // Rows end with "\r\n" instead of "\n"
+    chars_format fmt = chars_format::general;
+    int precision = -1; // Negative for the shortest representation
+};
+
+// Formats rows of typed columns into a buffer, which is written to a file descriptor in blocks of
+// about block_size bytes. Without a file descriptor (-1) the buffer grows and keeps all of the text.
+// After an error of the file descriptor every call returns that error.
+class csv_writer
+{
+    char* data_;
+    std::size_t size_;
+    std::size_t capacity_;
+    std::size_t block_size_;
+    int fd_;
+    std::errc ec_;
+
+    std::errc reserve(std::size_t n) noexcept;
+
+public:
+
+    static constexpr std::size_t default_block_size = static_cast<std::size_t>(1) << 20;
+
+    explicit csv_writer(int fd = -1, std::size_t block_size = default_block_size) noexcept
+        : data_(nullptr), size_(0), capacity_(0), block_size_(block_size == 0 ? 1 : block_size), fd_(fd), ec_()
+    {
+    }
+
+    // Flushes what is left; call flush() first to see its error
+    BOOST_CHARCONV_DECL ~csv_writer();
+
+    csv_writer(const csv_writer&) = delete;
+    csv_writer& operator=(const csv_writer&) = delete;
+
+    // Writes one line with the names, quoted where they contain the delimiter, a quote or a line break
+    BOOST_CHARCONV_DECL std::errc write_header(const char* const* names, std::size_t count,
+                                               const csv_write_options& options = csv_write_options()) noexcept;
+
+    // Writes rows [0, rows) of the arrays of columns
+    BOOST_CHARCONV_DECL std::errc write_rows(const const_csv_column* columns, std::size_t column_count, std::size_t rows,
+                                             const csv_write_options& options = csv_write_options()) noexcept;
+
+    template <std::size_t N>
+    std::errc write_header(const char* const (&names)[N], const csv_write_options& options = csv_write_options()) noexcept
+    {
+        return write_header(names, N, options);
+    }
+
+    template <std::size_t N>
+    std::errc write_rows(const const_csv_column (&columns)[N], std::size_t rows,
+                         const csv_write_options& options = csv_write_options()) noexcept
+    {
+        return write_rows(columns, N, rows, options);
+    }
+
+    // Writes the buffer to the file descriptor
+    BOOST_CHARCONV_DECL std::errc flush() noexcept;
+
+    // The text that has not been written to the file descriptor
+    const char* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+
+    void clear() noexcept { size_ = 0; }
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_CSV_HPP_INCLUDED
@@ -0,0 +1,76 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_CAPTURE_HPP
+#define BOOST_CHARCONV_DETAIL_CAPTURE_HPP
+
+#include <boost/charconv/capture.hpp>
+#include <boost/charconv/config.hpp>
+#include <cstddef>
+
+#ifdef BOOST_CHARCONV_ENABLE_CAPTURE
+
+namespace boost { namespace charconv { namespace detail {
+
+// Name of the type in the capture file
+template <typename T>
+struct capture_type_name
+{
+    static constexpr const char* value() noexcept { return "unknown"; }
+};
+
+template <>
+struct capture_type_name<float>
+{
+    static constexpr const char* value() noexcept { return "float"; }
+};
+
+template <>
+struct capture_type_name<double>
+{
+    static constexpr const char* value() noexcept { return "double"; }
+};
+
+template <>
+struct capture_type_name<long double>
+{
+    static constexpr const char* value() noexcept { return "long_double"; }
+};
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+template <>
+struct capture_type_name<__float128>
+{
+    static constexpr const char* value() noexcept { return "float128"; }
+};
+#endif
+
+// Records the characters of the number starting at first into the ring buffer of the calling thread
+BOOST_CHARCONV_DECL void capture_input(const char* kind, const char* type, const char* first, std::size_t length) noexcept;
+
+// Only narrow character input is captured
+template <typename UC>
+inline void capture_input(const char*, const char*, const UC*, std::size_t) noexcept
+{
+}
+
+// Records the bytes of a value into the ring buffer of the calling thread
+BOOST_CHARCONV_DECL void capture_value(const char* kind, const char* type, const void* value, std::size_t size, int fmt, int precision) noexcept;
+
+}}} // Namespaces
+
+#  define BOOST_CHARCONV_CAPTURE_INPUT(kind, T, first, length) \
+       boost::charconv::detail::capture_input(kind, boost::charconv::detail::capture_type_name<T>::value(), first, length)
+
+#  define BOOST_CHARCONV_CAPTURE_VALUE(kind, T, value, fmt, precision) \
+       boost::charconv::detail::capture_value(kind, boost::charconv::detail::capture_type_name<T>::value(), &(value), sizeof(T), static_cast<int>(fmt), precision)
+
+#else
+
+#  define BOOST_CHARCONV_CAPTURE_INPUT(kind, T, first, length) static_cast<void>(0)
+#  define BOOST_CHARCONV_CAPTURE_VALUE(kind, T, value, fmt, precision) static_cast<void>(0)
+
+#endif // BOOST_CHARCONV_ENABLE_CAPTURE
+
+#endif // BOOST_CHARCONV_DETAIL_CAPTURE_HPP
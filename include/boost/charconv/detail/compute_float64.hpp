@@ -9,6 +9,7 @@
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/significand_tables.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/stats.hpp>
 #include <boost/core/bit.hpp>
 #include <cstdint>
 #include <cfloat>
@@ -67,6 +68,7 @@ inline double compute_float64(std::int64_t power, std::uint64_t i, bool negative
             d = -d;
         }
 
+        BOOST_CHARCONV_STATS_COUNT(clinger);
         success = true;
         return d;
     }
@@ -192,6 +194,7 @@ inline double compute_float64(std::int64_t power, std::uint64_t i, bool negative
     double d;
     std::memcpy(&d, &significand, sizeof(d));
 
+    BOOST_CHARCONV_STATS_COUNT(eisel_lemire);
     success = true;
     return d;
 }
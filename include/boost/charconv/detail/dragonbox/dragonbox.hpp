@@ -1457,6 +1457,31 @@ namespace cache {
             return cache_format::cache[std::size_t(k - cache_format::min_k)];
         }
     };
+
+    // Recovers the binary64 entries from compressed_cache_detail (a few hundred bytes instead of ~10 KB),
+    // at the cost of two multiplications per lookup. The binary32 cache is small and always kept.
+    struct compact : base
+    {
+        using cache_policy = compact;
+
+        template <typename FloatFormat, typename std::enable_if<std::is_same<FloatFormat, ieee754_binary64>::value, bool>::type = true>
+        static uint128 get_cache(int k) noexcept
+        {
+            return compressed_cache_detail::get_cache(k);
+        }
+
+        template <typename FloatFormat, typename std::enable_if<!std::is_same<FloatFormat, ieee754_binary64>::value, bool>::type = true>
+        static constexpr typename cache_holder_ieee754_binary32::cache_entry_type get_cache(int k) noexcept
+        {
+            return cache_holder_ieee754_binary32::cache[std::size_t(k - cache_holder_ieee754_binary32::min_k)];
+        }
+    };
+
+    #ifdef BOOST_CHARCONV_COMPACT_TABLES
+    using default_cache = compact;
+    #else
+    using default_cache = full;
+    #endif
 }
 }
 
@@ -1522,6 +1547,7 @@ namespace binary_to_decimal_rounding {
 
 namespace cache {
     BOOST_INLINE_VARIABLE constexpr auto full = detail::policy_impl::cache::full{};
+    BOOST_INLINE_VARIABLE constexpr auto compact = detail::policy_impl::cache::compact{};
 }
 } // Namespace Policy
 
@@ -2402,7 +2428,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
     
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2413,7 +2439,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
@@ -2594,11 +2620,16 @@ namespace to_chars_detail {
             {
                 if (fmt != chars_format::scientific)
                 {
+                    if (buffer == last)
+                    {
+                        return {last, std::errc::value_too_large};
+                    }
+
                     std::memcpy(buffer, "0", 1); // NOLINT: Specifically not null-terminated
                     return {buffer + 1, std::errc()};
                 }
 
-                if (buffer_size >= 5)
+                if (last - buffer >= 5)
                 {
                     std::memcpy(buffer, "0e+00", 5); // NOLINT: Specifically not null-terminated
                     return {buffer + 5, std::errc()};
@@ -2718,7 +2749,7 @@ to_chars_result to_chars_n(Float x, char* first, char* last, chars_format fmt, B
 
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2729,7 +2760,7 @@ to_chars_result to_chars_n(Float x, char* first, char* last, chars_format fmt, B
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
@@ -406,7 +406,8 @@ BOOST_FORCEINLINE std::uint8_t load_extended_cache(CacheBlockType* blocks_ptr, i
     if (end_bit_index > src_end_bit_index)
     {
         const std::uint8_t number_of_trailing_zero_blocks =
-            static_cast<std::uint8_t>(end_bit_index - src_end_bit_index) / ExtendedCache::cache_bits_unit;
+            static_cast<std::uint8_t>(static_cast<std::uint32_t>(end_bit_index - src_end_bit_index) /
+                                      static_cast<std::uint32_t>(ExtendedCache::cache_bits_unit));
         excessive_bits_to_right = static_cast<std::uint32_t>(end_bit_index - src_end_bit_index) %
                                     static_cast<std::uint32_t>(ExtendedCache::cache_bits_unit);
 
@@ -820,47 +821,7 @@ struct main_cache_compressed
 
         BOOST_IF_CONSTEXPR (std::is_same<FloatFormat, ieee754_binary64>::value) 
         {
-            // Compute the base index.
-            const auto cache_index =
-                static_cast<int>(static_cast<std::uint32_t>(k - main_cache_holder::min_k) /
-                    compressed_cache_detail::compression_ratio);
-
-            const auto kb = cache_index * compressed_cache_detail::compression_ratio +
-                            main_cache_holder::min_k;
-
-            const auto offset = k - kb;
-
-            // Get the base cache.
-            const auto base_cache = compressed_cache_detail::cache_holder_t::table[cache_index];
-
-            if (offset == 0)
-            {
-                return base_cache;
-            }
-            else 
-            {
-
-                // Compute the required amount of bit-shift.
-                const auto alpha = log::floor_log2_pow10(kb + offset) - log::floor_log2_pow10(kb) - offset;
-                BOOST_CHARCONV_ASSERT(alpha > 0 && alpha < 64);
-
-                // Try to recover the real cache.
-                const auto pow5 = compressed_cache_detail::pow5_holder_t::table[offset];
-                auto recovered_cache = umul128(base_cache.high, pow5);
-                const auto middle_low = umul128(base_cache.low, pow5);
-
-                recovered_cache += middle_low.high;
-
-                const auto high_to_middle = recovered_cache.high << (64 - alpha);
-                const auto middle_to_low = recovered_cache.low << (64 - alpha);
-
-                recovered_cache = uint128{(recovered_cache.low >> alpha) | high_to_middle, ((middle_low.low >> alpha) | middle_to_low)};
-
-                BOOST_CHARCONV_ASSERT(recovered_cache.low + 1 != 0);
-                recovered_cache = uint128(recovered_cache.high, recovered_cache.low + 1);
-
-                return recovered_cache;
-            }
+            return compressed_cache_detail::get_cache(k);
         }
         else
         {
@@ -1027,7 +988,8 @@ template <bool b> constexpr typename extended_cache_long_impl<b>::multiplier_ind
 
 using extended_cache_long = extended_cache_long_impl<true>;
 
-struct extended_cache_compact 
+template <bool b>
+struct extended_cache_compact_impl
 {
     static constexpr std::size_t max_cache_blocks = 6;
     static constexpr std::size_t cache_bits_unit = 64;
@@ -1096,23 +1058,27 @@ struct extended_cache_compact
         0x61, 0x45, 0x23, 0x41, 0x23, 0x31, 0x12, 0x12, 0x01};
 };
 
-#ifdef BOOST_CXX17_INLINE_VARIABLES
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
 
-constexpr std::size_t extended_cache_compact::max_cache_blocks;
-constexpr std::size_t extended_cache_compact::cache_bits_unit;
-constexpr int extended_cache_compact::segment_length;
-constexpr bool extended_cache_compact::constant_block_count;
-constexpr int extended_cache_compact::collapse_factor;
-constexpr int extended_cache_compact::e_min;
-constexpr int extended_cache_compact::k_min;
-constexpr int extended_cache_compact::cache_bit_index_offset_base;
-constexpr int extended_cache_compact::cache_block_count_offset_base;
-constexpr extended_cache_compact::multiplier_index_info extended_cache_compact::multiplier_index_info_table[];
-constexpr std::uint8_t extended_cache_compact::cache_block_counts[];
+template <bool b> constexpr std::size_t extended_cache_compact_impl<b>::max_cache_blocks;
+template <bool b> constexpr std::size_t extended_cache_compact_impl<b>::cache_bits_unit;
+template <bool b> constexpr int extended_cache_compact_impl<b>::segment_length;
+template <bool b> constexpr bool extended_cache_compact_impl<b>::constant_block_count;
+template <bool b> constexpr int extended_cache_compact_impl<b>::collapse_factor;
+template <bool b> constexpr int extended_cache_compact_impl<b>::e_min;
+template <bool b> constexpr int extended_cache_compact_impl<b>::k_min;
+template <bool b> constexpr int extended_cache_compact_impl<b>::cache_bit_index_offset_base;
+template <bool b> constexpr int extended_cache_compact_impl<b>::cache_block_count_offset_base;
+template <bool b> constexpr std::uint64_t extended_cache_compact_impl<b>::cache[];
+template <bool b> constexpr typename extended_cache_compact_impl<b>::multiplier_index_info extended_cache_compact_impl<b>::multiplier_index_info_table[];
+template <bool b> constexpr std::uint8_t extended_cache_compact_impl<b>::cache_block_counts[];
 
 #endif
 
-struct extended_cache_super_compact 
+using extended_cache_compact = extended_cache_compact_impl<true>;
+
+template <bool b>
+struct extended_cache_super_compact_impl
 {
     static constexpr std::size_t max_cache_blocks = 15;
     static constexpr std::size_t cache_bits_unit = 64;
@@ -1159,21 +1125,33 @@ struct extended_cache_super_compact
                                                             0x24, 0x8a, 0x46, 0x62, 0x24, 0x13};
 };
 
-#ifdef BOOST_CXX17_INLINE_VARIABLES
-
-constexpr std::size_t extended_cache_super_compact::max_cache_blocks;
-constexpr std::size_t extended_cache_super_compact::cache_bits_unit;
-constexpr int extended_cache_super_compact::segment_length;
-constexpr bool extended_cache_super_compact::constant_block_count;
-constexpr int extended_cache_super_compact::collapse_factor;
-constexpr int extended_cache_super_compact::e_min;
-constexpr int extended_cache_super_compact::k_min;
-constexpr int extended_cache_super_compact::cache_bit_index_offset_base;
-constexpr int extended_cache_super_compact::cache_block_count_offset_base;
-constexpr std::uint64_t extended_cache_super_compact::cache[];
-constexpr extended_cache_super_compact::multiplier_index_info extended_cache_super_compact::multiplier_index_info_table[];
-constexpr std::uint8_t extended_cache_super_compact::cache_block_counts[];
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES) && (!defined(BOOST_MSVC) || BOOST_MSVC != 1900)
+
+template <bool b> constexpr std::size_t extended_cache_super_compact_impl<b>::max_cache_blocks;
+template <bool b> constexpr std::size_t extended_cache_super_compact_impl<b>::cache_bits_unit;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::segment_length;
+template <bool b> constexpr bool extended_cache_super_compact_impl<b>::constant_block_count;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::collapse_factor;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::e_min;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::k_min;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::cache_bit_index_offset_base;
+template <bool b> constexpr int extended_cache_super_compact_impl<b>::cache_block_count_offset_base;
+template <bool b> constexpr std::uint64_t extended_cache_super_compact_impl<b>::cache[];
+template <bool b> constexpr typename extended_cache_super_compact_impl<b>::multiplier_index_info extended_cache_super_compact_impl<b>::multiplier_index_info_table[];
+template <bool b> constexpr std::uint8_t extended_cache_super_compact_impl<b>::cache_block_counts[];
+
+#endif
+
+using extended_cache_super_compact = extended_cache_super_compact_impl<true>;
 
+// Tables used by to_chars for large precisions. The compact configuration trades some
+// speed for roughly a tenth of the data.
+#ifdef BOOST_CHARCONV_COMPACT_TABLES
+using floff_main_cache = main_cache_compressed;
+using floff_extended_cache = extended_cache_super_compact;
+#else
+using floff_main_cache = main_cache_full;
+using floff_extended_cache = extended_cache_long;
 #endif
 
 #ifdef BOOST_MSVC
@@ -1763,10 +1741,20 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
             const auto initial_digits = static_cast<std::uint32_t>(prod >> 32);
 
-            buffer -= (initial_digits < 10 ? 1 : 0);
-            remaining_digits -= (2 - (initial_digits < 10 ? 1 : 0));
-            print_2_digits(initial_digits, buffer);
-            buffer += 2;
+            // A single leading digit is printed on its own: in fixed format with precision 0
+            // there is no slot reserved for the decimal dot in front of it to print a 0 into.
+            if (initial_digits < 10)
+            {
+                print_1_digit(initial_digits, buffer);
+                ++buffer;
+                --remaining_digits;
+            }
+            else
+            {
+                print_2_digits(initial_digits, buffer);
+                buffer += 2;
+                remaining_digits -= 2;
+            }
 
             if (remaining_digits > remaining_digits_in_the_current_subsegment) 
             {
@@ -1927,12 +1915,20 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                 }
 
                 initial_digits = static_cast<std::uint32_t>(prod >> 32);
-                buffer -= (initial_digits < 10 ? 1 : 0);
                 remaining_digits -= (2 - (initial_digits < 10 ? 1 : 0));
             }
 
-            print_2_digits(initial_digits, buffer);
-            buffer += 2;
+            // As for the first subsegment, a single leading digit is printed on its own
+            if (first_subsegment == 0 && initial_digits < 10)
+            {
+                print_1_digit(initial_digits, buffer);
+                ++buffer;
+            }
+            else
+            {
+                print_2_digits(initial_digits, buffer);
+                buffer += 2;
+            }
 
             if (remaining_digits > remaining_digits_in_the_current_subsegment)
             {
@@ -3314,7 +3310,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                             if (check_rounding_condition_subsegment_boundary_with_next_subsegment(
                                     current_digits,
                                     uint_with_known_number_of_digits<9>{static_cast<std::uint32_t>(second_part)},
-                                    compute_has_further_digits<1, 9, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
+                                    compute_has_further_digits<1, 0, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
                             {
                                 goto round_up_two_digits;
                             }
@@ -3640,11 +3636,12 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                         last_subsegment_pair >>= 1;
 
                         const auto first_part = static_cast<std::uint32_t>(last_subsegment_pair / power_of_10[9]);
-                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair) - power_of_10[9] * first_part;
+                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair - power_of_10[9] * first_part);
 
                         if (remaining_digits <= 9)
                         {
                             std::uint64_t prod;
+                            const int remaining_digits_in_the_current_subsegment = 9 - remaining_digits;
 
                             if ((remaining_digits & 1) != 0)
                             {
@@ -3688,13 +3685,14 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
                             prod = static_cast<std::uint32_t>(prod) * UINT64_C(100);
                             current_digits = static_cast<std::uint32_t>(prod >> 32);
+                            remaining_digits = 0;
 
-                            if (remaining_digits < 9)
+                            if (remaining_digits_in_the_current_subsegment != 0)
                             {
                             segment_loop252_final18_first_part_rounding:
                                 if (check_rounding_condition_inside_subsegment(
                                         current_digits, static_cast<std::uint32_t>(prod),
-                                        9 - remaining_digits, compute_has_further_digits<1, 9, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
+                                        remaining_digits_in_the_current_subsegment, compute_has_further_digits<1, 9, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
                                 {
                                     goto round_up_two_digits;
                                 }
@@ -3717,6 +3715,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                         remaining_digits -= 9;
 
                         std::uint64_t prod;
+                        const int remaining_digits_in_the_current_subsegment = 9 - remaining_digits;
 
                         if ((remaining_digits & 1) != 0)
                         {
@@ -3760,12 +3759,13 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
                         prod = static_cast<std::uint32_t>(prod) * UINT64_C(100);
                         current_digits = static_cast<std::uint32_t>(prod >> 32);
+                        remaining_digits = 0;
 
-                        if (remaining_digits < 9)
+                        if (remaining_digits_in_the_current_subsegment != 0)
                         {
                         segment_loop252_final18_second_part_rounding:
                             if (check_rounding_condition_inside_subsegment(
-                                    current_digits, static_cast<std::uint32_t>(prod), 9 - remaining_digits,
+                                    current_digits, static_cast<std::uint32_t>(prod), remaining_digits_in_the_current_subsegment,
                                     compute_has_further_digits<1, 0, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
                             {
                                 goto round_up_two_digits;
@@ -9,6 +9,9 @@
 #include <boost/charconv/detail/dragonbox/floff.hpp>
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/stats.hpp>
+#include <boost/charconv/detail/probes.hpp>
+#include <boost/charconv/detail/capture.hpp>
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
 #include <type_traits>
@@ -30,6 +33,10 @@ inline int print_val(char* first, std::size_t size, char* format, T value) noexc
 template <typename T>
 to_chars_result to_chars_printf_impl(char* first, char* last, T value, chars_format fmt, int precision)
 {
+    BOOST_CHARCONV_STATS_TIER(printf);
+    BOOST_CHARCONV_PROBE4(to_chars_printf, &value, sizeof(T), static_cast<int>(fmt), precision);
+    BOOST_CHARCONV_CAPTURE_VALUE("printf", T, value, fmt, precision);
+
     // v % + . + num_digits(INT_MAX) + specifier + null terminator
     // 1 + 1 + 10 + 1 + 1
     char format[14] {};
@@ -76,6 +83,7 @@ to_chars_result to_chars_printf_impl(char* first, char* last, T value, chars_for
     switch (fmt)
     {
         case boost::charconv::chars_format::general:
+        case boost::charconv::chars_format::json:
             format[pos] = 'g';
             break;
 
@@ -99,6 +107,12 @@ to_chars_result to_chars_printf_impl(char* first, char* last, T value, chars_for
         return {last, static_cast<std::errc>(errno)};
     }
 
+    // The output was truncated to fit with the null terminator
+    if (rv >= last - first)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
     return {first + rv, std::errc()};
 }
 
@@ -209,6 +223,10 @@ from_chars_result from_chars_strtod_impl(const char* first, const char* last, T&
 template <typename T>
 inline from_chars_result from_chars_strtod(const char* first, const char* last, T& value) noexcept
 {
+    BOOST_CHARCONV_STATS_COUNT(strtod);
+    BOOST_CHARCONV_PROBE2(from_chars_strtod, first, static_cast<std::size_t>(last - first));
+    BOOST_CHARCONV_CAPTURE_INPUT("strtod", T, first, static_cast<std::size_t>(last - first));
+
     if (last - first < 1024)
     {
         char buffer[1024];
@@ -9,6 +9,7 @@
 #define BOOST_CHARCONV_DETAIL_FASTFLOAT_ASCII_NUMBER_HPP
 
 #include <boost/charconv/detail/fast_float/float_common.hpp>
+#include <boost/charconv/detail/swar_digits.hpp>
 #include <cctype>
 #include <cstdint>
 #include <cstring>
@@ -44,13 +45,7 @@ uint64_t read_u64(const char *chars) {
     }
     return val;
   }
-  uint64_t val;
-  ::memcpy(&val, chars, sizeof(uint64_t));
-#if BOOST_CHARCONV_FASTFLOAT_IS_BIG_ENDIAN == 1
-  // Need to read as-if the number was in little-endian order.
-  val = byteswap(val);
-#endif
-  return val;
+  return boost::charconv::detail::read_eight_chars(chars);
 }
 
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
@@ -70,51 +65,132 @@ void write_u64(uint8_t *chars, uint64_t val) {
   ::memcpy(chars, &val, sizeof(uint64_t));
 }
 
-// credit  @aqrit
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR14
 uint32_t parse_eight_digits_unrolled(uint64_t val) {
-  constexpr uint64_t mask = 0x000000FF000000FF;
-  constexpr uint64_t mul1 = 0x000F424000000064; // 100 + (1000000ULL << 32)
-  constexpr uint64_t mul2 = 0x0000271000000001; // 1 + (10000ULL << 32)
-  val -= 0x3030303030303030;
-  val = (val * 10) + (val >> 8); // val = (val * 2561) >> 8;
-  val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
-  return uint32_t(val);
+  return boost::charconv::detail::parse_eight_decimal_digits(val);
 }
 
-BOOST_FORCEINLINE constexpr
-uint32_t parse_eight_digits_unrolled(const char16_t *)  noexcept  {
-  return 0;
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+uint32_t parse_eight_digits_unrolled(const char *chars)  noexcept  {
+  return parse_eight_digits_unrolled(read_u64(chars));
 }
 
-BOOST_FORCEINLINE constexpr
-uint32_t parse_eight_digits_unrolled(const char32_t *)  noexcept  {
-  return 0;
+BOOST_FORCEINLINE constexpr bool is_made_of_eight_digits_fast(uint64_t val)  noexcept  {
+  return boost::charconv::detail::non_decimal_digits(val) == 0;
 }
 
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-uint32_t parse_eight_digits_unrolled(const char *chars)  noexcept  {
-  return parse_eight_digits_unrolled(read_u64(chars));
+bool is_made_of_eight_digits_fast(const char *chars)  noexcept  {
+  return is_made_of_eight_digits_fast(read_u64(chars));
 }
 
-// credit @aqrit
-BOOST_FORCEINLINE constexpr bool is_made_of_eight_digits_fast(uint64_t val)  noexcept  {
-  return !((((val + 0x4646464646464646) | (val - 0x3030303030303030)) & 0x8080808080808080));
+// Wide code units (char16_t, char32_t and wchar_t) are loaded 8 bytes at a time as well, with one
+// unit per lane of 16 or 32 bits. The lanes are in the order of the units and keep their values,
+// so the digit test of @aqrit works on every lane at once, and after packing the low byte of each
+// lane the eight digits are converted by the kernel for char.
+
+template <typename UC>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+uint64_t read_lanes(UC const *chars) noexcept {
+  constexpr int lanes = int(8 / sizeof(UC));
+  if (cpp20_and_in_constexpr()) {
+    constexpr uint64_t lane_mask = (uint64_t(1) << (64 / lanes)) - 1;
+    uint64_t val = 0;
+    for(int i = 0; i < lanes; ++i) {
+      val |= (uint64_t(chars[i]) & lane_mask) << (i * 64 / lanes);
+    }
+    return val;
+  }
+  uint64_t val;
+  ::memcpy(&val, chars, sizeof(uint64_t));
+#if BOOST_CHARCONV_FASTFLOAT_IS_BIG_ENDIAN == 1
+  // Reverse the order of the lanes, but not the bytes within them
+  if (lanes == 2) {
+    val = (val << 32) | (val >> 32);
+  } else {
+    val = (val << 48) | ((val & 0xFFFF0000) << 16) | ((val >> 16) & 0xFFFF0000) | (val >> 48);
+  }
+#endif
+  return val;
 }
 
-BOOST_FORCEINLINE constexpr
-bool is_made_of_eight_digits_fast(const char16_t *)  noexcept  {
-  return false;
+// Non-zero for any lane outside of ['0', '9']. A lane only carries or borrows into the next one if it is
+// flagged itself, so the result is exact.
+BOOST_FORCEINLINE constexpr uint64_t non_digit_lanes_u16(uint64_t val) noexcept {
+  return ((val + 0x7FC67FC67FC67FC6) | (val - 0x0030003000300030)) & 0x8000800080008000;
 }
 
-BOOST_FORCEINLINE constexpr
-bool is_made_of_eight_digits_fast(const char32_t *)  noexcept  {
-  return false;
+BOOST_FORCEINLINE constexpr uint64_t non_digit_lanes_u32(uint64_t val) noexcept {
+  return ((val + 0x7FFFFFC67FFFFFC6) | (val - 0x0000003000000030)) & 0x8000000080000000;
 }
 
+// The four digits of a word of 16-bit lanes as four bytes: the high byte of each lane is zero,
+// so or-ing in the word shifted by a byte places lanes 0 and 1 in bytes 0-1, and lanes 2 and 3 in bytes 4-5
+BOOST_FORCEINLINE constexpr uint64_t pack_lanes_u16(uint64_t val) noexcept {
+  return ((val | (val >> 8)) & 0x000000000000FFFF) | (((val | (val >> 8)) >> 16) & 0x00000000FFFF0000);
+}
+
+// The two digits of a word of 32-bit lanes as two bytes
+BOOST_FORCEINLINE constexpr uint64_t pack_lanes_u32(uint64_t val) noexcept {
+  return (val | (val >> 24)) & 0x000000000000FFFF;
+}
+
+template <typename UC, typename std::enable_if<sizeof(UC) == 2, bool>::type = true>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-bool is_made_of_eight_digits_fast(const char *chars)  noexcept  {
-  return is_made_of_eight_digits_fast(read_u64(chars));
+bool is_made_of_eight_digits_fast(UC const *chars) noexcept {
+  return (non_digit_lanes_u16(read_lanes(chars)) | non_digit_lanes_u16(read_lanes(chars + 4))) == 0;
+}
+
+template <typename UC, typename std::enable_if<sizeof(UC) == 2, bool>::type = true>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+uint32_t parse_eight_digits_unrolled(UC const *chars) noexcept {
+  return parse_eight_digits_unrolled(pack_lanes_u16(read_lanes(chars)) | (pack_lanes_u16(read_lanes(chars + 4)) << 32));
+}
+
+template <typename UC, typename std::enable_if<sizeof(UC) == 4, bool>::type = true>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+bool is_made_of_eight_digits_fast(UC const *chars) noexcept {
+  return (non_digit_lanes_u32(read_lanes(chars)) | non_digit_lanes_u32(read_lanes(chars + 2)) |
+          non_digit_lanes_u32(read_lanes(chars + 4)) | non_digit_lanes_u32(read_lanes(chars + 6))) == 0;
+}
+
+template <typename UC, typename std::enable_if<sizeof(UC) == 4, bool>::type = true>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+uint32_t parse_eight_digits_unrolled(UC const *chars) noexcept {
+  return parse_eight_digits_unrolled(pack_lanes_u32(read_lanes(chars)) | (pack_lanes_u32(read_lanes(chars + 2)) << 16) |
+                                     (pack_lanes_u32(read_lanes(chars + 4)) << 32) | (pack_lanes_u32(read_lanes(chars + 6)) << 48));
+}
+
+// Consumes the run of digits starting at p into i, reading 8 bytes at a time.
+// Requires at least 8 readable bytes past pend, since the final load may extend beyond it.
+template <typename UC>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR14
+void consume_digits_padded(UC const *& p, UC const * pend, uint64_t& i) noexcept {
+  while ((p != pend) && is_integer(*p)) {
+    i = 10 * i + uint64_t(*p - UC('0'));
+    ++p;
+  }
+}
+
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+void consume_digits_padded(char const *& p, char const * pend, uint64_t& i) noexcept {
+  for (;;) {
+    const uint64_t val = read_u64(p);
+    uint32_t n = boost::charconv::detail::leading_decimal_digits(val);
+    if (pend - p < int64_t(n)) {
+      n = uint32_t(pend - p);
+    }
+    if (n == 8) {
+      i = i * 100000000 + parse_eight_digits_unrolled(val); // in rare cases, this will overflow, but that's ok
+      p += 8;
+      continue;
+    }
+    if (n != 0) {
+      i = i * boost::charconv::detail::powers_of_ten_uint32[n] + boost::charconv::detail::parse_leading_decimal_digits(val, n);
+      p += n;
+    }
+    return;
+  }
 }
 
 template <typename UC>
@@ -133,11 +209,15 @@ using byte_span = span<char>;
 using parsed_number_string = parsed_number_string_t<char>;
 // Assuming that you use no more than 19 digits, this will
 // parse an ASCII string.
-template <typename UC>
+//
+// When Padded is true the caller guarantees that at least 8 bytes past pend are readable,
+// which allows the digit runs to be consumed with unconditional 8 byte loads.
+template <typename UC, bool Padded = false>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, parse_options_t<UC> options) noexcept {
   chars_format const fmt = options.format;
   UC const decimal_point = options.decimal_point;
+  bool const json = is_json_format(fmt);
 
   parsed_number_string_t<UC> answer;
   answer.valid = false;
@@ -159,34 +239,51 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
   }
   UC const * const start_digits = p;
 
+  // JSON needs a digit first, which also rules out ".5", "inf" and "nan"
+  if (json && ((p == pend) || !is_integer(*p))) {
+    return answer;
+  }
+
   uint64_t i = 0; // an unsigned int avoids signed overflows (which are bad)
 
-  while ((p != pend) && is_integer(*p)) {
-    // a multiplication by 10 is cheaper than an arbitrary integer
-    // multiplication
-    i = 10 * i +
-        uint64_t(*p - UC('0')); // might overflow, we will handle the overflow later
-    ++p;
+  if (Padded) {
+    consume_digits_padded(p, pend, i); // might overflow, we will handle the overflow later
+  } else {
+    while ((p != pend) && is_integer(*p)) {
+      // a multiplication by 10 is cheaper than an arbitrary integer
+      // multiplication
+      i = 10 * i +
+          uint64_t(*p - UC('0')); // might overflow, we will handle the overflow later
+      ++p;
+    }
   }
   UC const * const end_of_integer_part = p;
   int64_t digit_count = int64_t(end_of_integer_part - start_digits);
   answer.integer = span<const UC>(start_digits, size_t(digit_count));
+  if (json && (digit_count > 1) && (*start_digits == UC('0'))) { // no leading zeros in JSON
+    return answer;
+  }
   int64_t exponent = 0;
   if ((p != pend) && (*p == decimal_point)) {
     ++p;
     UC const * before = p;
     // can occur at most twice without overflowing, but let it occur more, since
     // for integers with many digits, digit parsing is the primary bottleneck.
-    if (std::is_same<UC,char>::value) {
+    if (Padded) {
+      consume_digits_padded(p, pend, i); // in rare cases, this will overflow, but that's ok
+    } else {
       while ((std::distance(p, pend) >= 8) && is_made_of_eight_digits_fast(p)) {
         i = i * 100000000 + parse_eight_digits_unrolled(p); // in rare cases, this will overflow, but that's ok
         p += 8;
       }
+      while ((p != pend) && is_integer(*p)) {
+        uint8_t digit = uint8_t(*p - UC('0'));
+        ++p;
+        i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
+      }
     }
-    while ((p != pend) && is_integer(*p)) {
-      uint8_t digit = uint8_t(*p - UC('0'));
-      ++p;
-      i = i * 10 + digit; // in rare cases, this will overflow, but that's ok
+    if (json && (p == before)) { // JSON needs a digit after the decimal point
+      return answer;
     }
     exponent = before - p;
     answer.fraction = span<const UC>(before, size_t(p - before));
@@ -208,8 +305,8 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
       ++p;
     }
     if ((p == pend) || !is_integer(*p)) {
-      if(!(static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::fixed))) {
-        // We are in error.
+      if(json || !(static_cast<unsigned>(fmt) & static_cast<unsigned>(chars_format::fixed))) {
+        // We are in error, as is JSON for an 'e' without digits.
         return answer;
       }
       // Otherwise, we will be ignoring the 'e'.
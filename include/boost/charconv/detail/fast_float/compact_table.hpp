@@ -0,0 +1,113 @@
+// Copyright 2020-2023 Daniel Lemire
+// Copyright 2023 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Derivative of: https://github.com/fastfloat/fast_float
+
+#ifndef BOOST_CHARCONV_DETAIL_FASTFLOAT_COMPACT_TABLE_HPP
+#define BOOST_CHARCONV_DETAIL_FASTFLOAT_COMPACT_TABLE_HPP
+
+#include <boost/charconv/detail/fast_float/float_common.hpp>
+#include <boost/charconv/detail/fast_float/fast_table.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox_common.hpp>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail { namespace fast_float {
+
+/**
+ * Replacement for powers::power_of_five_128 used with BOOST_CHARCONV_COMPACT_TABLES.
+ *
+ * The dragonbox cache holds the same powers of five for q in [-292, 326], rounded up
+ * instead of truncated, except for q in [-27, 55] where both are exact.
+ * The entries are recovered from the compressed dragonbox cache, which is shared with
+ * to_chars, and only the powers below the range of dragonbox are stored here.
+ */
+template <class unused = void>
+struct compact_powers_template {
+
+constexpr static int smallest_power_of_five = powers::smallest_power_of_five;
+constexpr static int largest_power_of_five = powers::largest_power_of_five;
+constexpr static int first_shared_power = boost::charconv::detail::main_cache_holder::min_k;
+constexpr static int number_of_low_entries = 2 * (first_shared_power - smallest_power_of_five);
+
+// Powers of five from 5^-342 to 5^-293 rounded toward one.
+constexpr static uint64_t low_powers_of_five_128[number_of_low_entries] = {
+    0xeef453d6923bd65a,0x113faa2906a13b3f,
+    0x9558b4661b6565f8,0x4ac7ca59a424c507,
+    0xbaaee17fa23ebf76,0x5d79bcf00d2df649,
+    0xe95a99df8ace6f53,0xf4d82c2c107973dc,
+    0x91d8a02bb6c10594,0x79071b9b8a4be869,
+    0xb64ec836a47146f9,0x9748e2826cdee284,
+    0xe3e27a444d8d98b7,0xfd1b1b2308169b25,
+    0x8e6d8c6ab0787f72,0xfe30f0f5e50e20f7,
+    0xb208ef855c969f4f,0xbdbd2d335e51a935,
+    0xde8b2b66b3bc4723,0xad2c788035e61382,
+    0x8b16fb203055ac76,0x4c3bcb5021afcc31,
+    0xaddcb9e83c6b1793,0xdf4abe242a1bbf3d,
+    0xd953e8624b85dd78,0xd71d6dad34a2af0d,
+    0x87d4713d6f33aa6b,0x8672648c40e5ad68,
+    0xa9c98d8ccb009506,0x680efdaf511f18c2,
+    0xd43bf0effdc0ba48,0x212bd1b2566def2,
+    0x84a57695fe98746d,0x14bb630f7604b57,
+    0xa5ced43b7e3e9188,0x419ea3bd35385e2d,
+    0xcf42894a5dce35ea,0x52064cac828675b9,
+    0x818995ce7aa0e1b2,0x7343efebd1940993,
+    0xa1ebfb4219491a1f,0x1014ebe6c5f90bf8,
+    0xca66fa129f9b60a6,0xd41a26e077774ef6,
+    0xfd00b897478238d0,0x8920b098955522b4,
+    0x9e20735e8cb16382,0x55b46e5f5d5535b0,
+    0xc5a890362fddbc62,0xeb2189f734aa831d,
+    0xf712b443bbd52b7b,0xa5e9ec7501d523e4,
+    0x9a6bb0aa55653b2d,0x47b233c92125366e,
+    0xc1069cd4eabe89f8,0x999ec0bb696e840a,
+    0xf148440a256e2c76,0xc00670ea43ca250d,
+    0x96cd2a865764dbca,0x380406926a5e5728,
+    0xbc807527ed3e12bc,0xc605083704f5ecf2,
+    0xeba09271e88d976b,0xf7864a44c633682e,
+    0x93445b8731587ea3,0x7ab3ee6afbe0211d,
+    0xb8157268fdae9e4c,0x5960ea05bad82964,
+    0xe61acf033d1a45df,0x6fb92487298e33bd,
+    0x8fd0c16206306bab,0xa5d3b6d479f8e056,
+    0xb3c4f1ba87bc8696,0x8f48a4899877186c,
+    0xe0b62e2929aba83c,0x331acdabfe94de87,
+    0x8c71dcd9ba0b4925,0x9ff0c08b7f1d0b14,
+    0xaf8e5410288e1b6f,0x7ecf0ae5ee44dd9,
+    0xdb71e91432b1a24a,0xc9e82cd9f69d6150,
+    0x892731ac9faf056e,0xbe311c083a225cd2,
+    0xab70fe17c79ac6ca,0x6dbd630a48aaf406,
+    0xd64d3d9db981787d,0x92cbbccdad5b108,
+    0x85f0468293f0eb4e,0x25bbf56008c58ea5,
+    0xa76c582338ed2621,0xaf2af2b80af6f24e,
+    0xd1476e2c07286faa,0x1af5af660db4aee1,
+    0x82cca4db847945ca,0x50d98d9fc890ed4d,
+    0xa37fce126597973c,0xe50ff107bab528a0,
+    0xcc5fc196fefd7d0c,0x1e53ed49a96272c8,};
+};
+
+template <class unused>
+constexpr uint64_t compact_powers_template<unused>::low_powers_of_five_128[number_of_low_entries];
+
+using compact_powers = compact_powers_template<>;
+
+// Returns the same words as powers::power_of_five_128[2 * (q - smallest_power_of_five)] and the entry after it
+inline value128 compact_power_of_five_128(int64_t q) noexcept {
+  BOOST_CHARCONV_ASSERT(q >= compact_powers::smallest_power_of_five && q <= compact_powers::largest_power_of_five);
+
+  if (q < compact_powers::first_shared_power) {
+    const auto index = static_cast<std::size_t>(2 * (q - compact_powers::smallest_power_of_five));
+    return value128(compact_powers::low_powers_of_five_128[index + 1], compact_powers::low_powers_of_five_128[index]);
+  }
+
+  const auto cache = boost::charconv::detail::compressed_cache_detail::get_cache(static_cast<int>(q));
+
+  if (q >= -27 && q <= 55) {
+    return value128(cache.low, cache.high);
+  }
+
+  return value128(cache.low - 1, cache.high - static_cast<uint64_t>(cache.low == 0));
+}
+
+}}}} // namespace fast_float
+
+#endif
@@ -10,6 +10,9 @@
 
 #include <boost/charconv/detail/fast_float/float_common.hpp>
 #include <boost/charconv/detail/fast_float/fast_table.hpp>
+#ifdef BOOST_CHARCONV_COMPACT_TABLES
+#include <boost/charconv/detail/fast_float/compact_table.hpp>
+#endif
 #include <cfloat>
 #include <cinttypes>
 #include <cmath>
@@ -26,18 +29,23 @@ namespace boost { namespace charconv { namespace detail { namespace fast_float {
 template <int bit_precision>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 value128 compute_product_approximation(int64_t q, uint64_t w) {
+#ifdef BOOST_CHARCONV_COMPACT_TABLES
+  const value128 power_of_five = compact_power_of_five_128(q);
+#else
   const int index = 2 * int(q - powers::smallest_power_of_five);
+  const value128 power_of_five(powers::power_of_five_128[index + 1], powers::power_of_five_128[index]);
+#endif
   // For small values of q, e.g., q in [0,27], the answer is always exact because
-  // The line value128 firstproduct = full_multiplication(w, power_of_five_128[index]);
+  // The line value128 firstproduct = full_multiplication(w, power_of_five.high);
   // gives the exact answer.
-  value128 firstproduct = full_multiplication(w, powers::power_of_five_128[index]);
+  value128 firstproduct = full_multiplication(w, power_of_five.high);
   static_assert((bit_precision >= 0) && (bit_precision <= 64), " precision should  be in (0,64]");
   constexpr uint64_t precision_mask = (bit_precision < 64) ?
                (uint64_t(0xFFFFFFFFFFFFFFFF) >> bit_precision)
                : uint64_t(0xFFFFFFFFFFFFFFFF);
   if((firstproduct.high & precision_mask) == precision_mask) { // could further guard with  (lower + w < lower)
     // regarding the second product, we only need secondproduct.high, but our expectation is that the compiler will optimize this extra work away if needed.
-    value128 secondproduct = full_multiplication(w, powers::power_of_five_128[index + 1]);
+    value128 secondproduct = full_multiplication(w, power_of_five.low);
     firstproduct.low += secondproduct.high;
     if(secondproduct.high > firstproduct.low) {
       firstproduct.high++;
@@ -9,6 +9,7 @@
 #define BOOST_CHARCONV_DETAIL_FASTFLOAT_FAST_FLOAT_HPP
 
 #include <boost/charconv/detail/fast_float/float_common.hpp>
+#include <boost/charconv/detail/fast_float/ascii_number.hpp>
 
 namespace boost { namespace charconv { namespace detail { namespace fast_float {
 /**
@@ -43,6 +44,24 @@ BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
                                       T &value, parse_options_t<UC> options)  noexcept;
 
+/**
+ * Like from_chars, but the caller guarantees that at least 8 bytes past `last` are readable.
+ * Digit runs are then consumed with unconditional 8 byte loads instead of per-character bounds checks.
+ * The characters past `last` never influence the result.
+ */
+template<typename T, typename UC = char>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_padded(UC const * first, UC const * last,
+                                    T &value, chars_format fmt = chars_format::general)  noexcept;
+
+/**
+ * Converts a number previously parsed with parse_number_string.
+ * The spans in `pns` must still point at the original characters.
+ */
+template<typename T, typename UC = char>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_advanced(parsed_number_string_t<UC>& pns, T &value)  noexcept;
+
 }}}} // namespace fast_float
 #include <boost/charconv/detail/fast_float/parse_number.hpp>
 #endif // BOOST_CHARCONV_FASTFLOAT_FAST_FLOAT_H
@@ -35,6 +35,12 @@ struct parse_options_t {
 };
 using parse_options = parse_options_t<char>;
 
+// chars_format::json is general plus the bit that selects the stricter grammar
+constexpr bool is_json_format(chars_format fmt) noexcept {
+  return (static_cast<unsigned>(fmt) &
+          (static_cast<unsigned>(chars_format::json) & ~static_cast<unsigned>(chars_format::general))) != 0;
+}
+
 }}}}
 
 #if BOOST_CHARCONV_FASTFLOAT_HAS_BIT_CAST
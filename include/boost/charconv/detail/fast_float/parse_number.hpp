@@ -12,6 +12,9 @@
 #include <boost/charconv/detail/fast_float/decimal_to_binary.hpp>
 #include <boost/charconv/detail/fast_float/digit_comparison.hpp>
 #include <boost/charconv/detail/fast_float/float_common.hpp>
+#include <boost/charconv/detail/stats.hpp>
+#include <boost/charconv/detail/probes.hpp>
+#include <boost/charconv/detail/capture.hpp>
 
 #include <cmath>
 #include <cstring>
@@ -181,8 +184,48 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   }
   parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
   if (!pns.valid) {
+    if (is_json_format(options.format)) {
+      answer.ec = std::errc::invalid_argument;
+      answer.ptr = first;
+      return answer;
+    }
     return detail::parse_infnan(first, last, value);
   }
+  return from_chars_advanced(pns, value);
+}
+
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_padded(UC const * first, UC const * last,
+                                    T &value, chars_format fmt /*= chars_format::general*/)  noexcept  {
+
+  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
+
+  from_chars_result_t<UC> answer;
+  if (first == last) {
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  parsed_number_string_t<UC> pns = parse_number_string<UC, true>(first, last, parse_options_t<UC>{fmt});
+  if (!pns.valid) {
+    if (is_json_format(fmt)) {
+      answer.ec = std::errc::invalid_argument;
+      answer.ptr = first;
+      return answer;
+    }
+    return detail::parse_infnan(first, last, value);
+  }
+  return from_chars_advanced(pns, value);
+}
+
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_advanced(parsed_number_string_t<UC>& pns, T &value)  noexcept  {
+
+  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
+
+  from_chars_result_t<UC> answer;
   answer.ec = std::errc(); // be optimistic
   answer.ptr = pns.lastmatch;
   // The implementation of the Clinger's fast path is convoluted because
@@ -206,6 +249,7 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
         if (pns.exponent < 0) { value = value / binary_format<T>::exact_power_of_ten(-pns.exponent); }
         else { value = value * binary_format<T>::exact_power_of_ten(pns.exponent); }
         if (pns.negative) { value = -value; }
+        BOOST_CHARCONV_STATS_COUNT(clinger);
         return answer;
       }
     } else {
@@ -216,11 +260,13 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
         // Clang may map 0 to -0.0 when fegetround() == FE_DOWNWARD
         if(pns.mantissa == 0) {
           value = pns.negative ? -0. : 0.;
+          BOOST_CHARCONV_STATS_COUNT(clinger);
           return answer;
         }
 #endif
         value = T(pns.mantissa) * binary_format<T>::exact_power_of_ten(pns.exponent);
         if (pns.negative) { value = -value; }
+        BOOST_CHARCONV_STATS_COUNT(clinger);
         return answer;
       }
     }
@@ -233,7 +279,15 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   }
   // If we called compute_float<binary_format<T>>(pns.exponent, pns.mantissa) and we have an invalid power (am.power2 < 0),
   // then we need to go the long way around again. This is very uncommon.
-  if(am.power2 < 0) { am = digit_comp<T>(pns, am); }
+  if(am.power2 < 0) {
+    BOOST_CHARCONV_STATS_COUNT(bigint);
+    BOOST_CHARCONV_PROBE2(digit_comp, pns.integer.ptr, static_cast<size_t>(pns.lastmatch - pns.integer.ptr));
+    BOOST_CHARCONV_CAPTURE_INPUT("bigint", T, pns.integer.ptr - static_cast<int>(pns.negative),
+                                 static_cast<size_t>(pns.lastmatch - pns.integer.ptr) + static_cast<size_t>(pns.negative));
+    am = digit_comp<T>(pns, am);
+  } else {
+    BOOST_CHARCONV_STATS_COUNT(eisel_lemire);
+  }
   to_float(pns.negative, am, value);
   // Test for over/underflow.
   if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == binary_format<T>::infinite_power()) {
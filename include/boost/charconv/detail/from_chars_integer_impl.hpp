@@ -9,9 +9,11 @@
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/from_chars_result.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
+#include <boost/charconv/detail/swar_digits.hpp>
 #include <boost/charconv/detail/type_traits.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/config.hpp>
+#include <boost/core/bit.hpp>
 #include <system_error>
 #include <type_traits>
 #include <limits>
@@ -19,6 +21,7 @@
 #include <cerrno>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace boost { namespace charconv { namespace detail {
 
@@ -48,6 +51,48 @@ constexpr unsigned char digit_from_char(char val) noexcept
     return uchar_values[static_cast<unsigned char>(val)];
 }
 
+// Wide code units (char16_t, char32_t and wchar_t) past the table are never digits
+template <typename UC>
+constexpr unsigned char digit_from_char(UC val) noexcept
+{
+    return static_cast<std::uint32_t>(val) > 255U ? static_cast<unsigned char>(255) : uchar_values[static_cast<unsigned char>(val)];
+}
+
+// Consumes up to nd - i leading decimal digits of a padded buffer 8 at a time
+template <typename Unsigned_Integer>
+inline void from_chars_padded_digits(const char*& next, std::ptrdiff_t nc, std::ptrdiff_t nd, std::ptrdiff_t& i,
+                                     Unsigned_Integer& result, std::true_type) noexcept
+{
+    for (;;)
+    {
+        const std::uint64_t chars = read_eight_chars(next);
+        std::ptrdiff_t n = static_cast<std::ptrdiff_t>(leading_decimal_digits(chars));
+        n = n < nd - i ? n : nd - i;
+        n = n < nc - i ? n : nc - i;
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        result = static_cast<Unsigned_Integer>(result * powers_of_ten_uint32[n] + parse_leading_decimal_digits(chars, static_cast<std::uint32_t>(n)));
+        next += n;
+        i += n;
+
+        if (n != 8)
+        {
+            break;
+        }
+    }
+}
+
+// Unpadded buffers, wide code units, and types where nd < 8 take the loop of one digit at a time
+template <typename UC, typename Unsigned_Integer>
+BOOST_CXX14_CONSTEXPR void from_chars_padded_digits(const UC*&, std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t&,
+                                                    Unsigned_Integer&, std::false_type) noexcept
+{
+}
+
 #ifdef BOOST_MSVC
 # pragma warning(push)
 # pragma warning(disable: 4146) // unary minus operator applied to unsigned type, result still unsigned
@@ -70,8 +115,9 @@ constexpr unsigned char digit_from_char(char val) noexcept
 
 #endif
 
-template <typename Integer, typename Unsigned_Integer>
-BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* first, const char* last, Integer& value, int base) noexcept
+// When Padded is true the caller guarantees that at least 8 bytes past last are readable
+template <typename Integer, typename Unsigned_Integer, bool Padded = false, typename UC>
+BOOST_CXX14_CONSTEXPR from_chars_result_t<UC> from_chars_integer_impl(const UC* first, const UC* last, Integer& value, int base) noexcept
 {
     Unsigned_Integer result = 0;
     Unsigned_Integer overflow_value = 0;
@@ -173,6 +219,7 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
 
     bool overflowed = false;
 
+    const UC* const first_digit = next;
     const std::ptrdiff_t nc = last - next;
 
     // In non-GNU mode on GCC numeric limits may not be specialized
@@ -187,6 +234,14 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
     {
         std::ptrdiff_t i = 0;
 
+        // Overflow is not possible in the first nd characters, so with a padded buffer
+        // they can be consumed 8 at a time without checking the remaining length first
+        if (base == 10)
+        {
+            from_chars_padded_digits(next, nc, nd, i, result,
+                std::integral_constant<bool, Padded && std::is_same<UC, char>::value && std::is_integral<Unsigned_Integer>::value && (nd >= 8)>());
+        }
+
         for( ; i < nd && i < nc; ++i )
         {
             // overflow is not possible in the first nd characters
@@ -225,6 +280,12 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
         }
     }
 
+    // A sign, or nothing, followed by a character that is not a digit does not match the pattern
+    if (next == first_digit)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
     // Return the parsed value, adding the sign back if applicable
     // If we have overflowed then we do not return the result 
     if (overflowed)
@@ -254,16 +315,23 @@ BOOST_CXX14_CONSTEXPR from_chars_result from_chars_integer_impl(const char* firs
 #endif
 
 // Only from_chars for integer types is constexpr (as of C++23)
-template <typename Integer>
-BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars(const char* first, const char* last, Integer& value, int base = 10) noexcept
+template <typename Integer, typename UC>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<UC> from_chars(const UC* first, const UC* last, Integer& value, int base = 10) noexcept
 {
     using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
     return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
 }
 
-#ifdef BOOST_CHARCONV_HAS_INT128
 template <typename Integer>
-BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result from_chars128(const char* first, const char* last, Integer& value, int base = 10) noexcept
+inline from_chars_result from_chars_padded(const char* first, const char* last, Integer& value, int base = 10) noexcept
+{
+    using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
+    return detail::from_chars_integer_impl<Integer, Unsigned_Integer, true>(first, last, value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+template <typename Integer, typename UC>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result_t<UC> from_chars128(const UC* first, const UC* last, Integer& value, int base = 10) noexcept
 {
     using Unsigned_Integer = boost::uint128_type;
     return detail::from_chars_integer_impl<Integer, Unsigned_Integer>(first, last, value, base);
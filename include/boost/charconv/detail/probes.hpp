@@ -0,0 +1,26 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_PROBES_HPP
+#define BOOST_CHARCONV_DETAIL_PROBES_HPP
+
+// USDT (SystemTap / DTrace) probes at the entry of the slow paths.
+// A probe is a single nop until a tracer (e.g. bpftrace or perf) attaches to it.
+// They are only compiled in when the library is built with BOOST_CHARCONV_ENABLE_USDT and <sys/sdt.h> is available.
+
+#ifdef BOOST_CHARCONV_ENABLE_USDT
+
+#include <sys/sdt.h>
+
+#  define BOOST_CHARCONV_PROBE2(name, arg1, arg2) DTRACE_PROBE2(boost_charconv, name, arg1, arg2)
+#  define BOOST_CHARCONV_PROBE4(name, arg1, arg2, arg3, arg4) DTRACE_PROBE4(boost_charconv, name, arg1, arg2, arg3, arg4)
+
+#else
+
+#  define BOOST_CHARCONV_PROBE2(name, arg1, arg2) static_cast<void>(0)
+#  define BOOST_CHARCONV_PROBE4(name, arg1, arg2, arg3, arg4) static_cast<void>(0)
+
+#endif // BOOST_CHARCONV_ENABLE_USDT
+
+#endif // BOOST_CHARCONV_DETAIL_PROBES_HPP
@@ -286,6 +286,11 @@ static inline int copy_special_str(char* result, const std::ptrdiff_t result_siz
 {
     if (fd.sign)
     {
+        if (result_size < 1)
+        {
+            return -1;
+        }
+
         *result = '-';
         ++result;
     }
@@ -369,13 +374,20 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
     }
 
     // Step 5: Print the decimal representation.
+    // Every check below is against the space left after the sign
+    const ptrdiff_t size = result_size - static_cast<ptrdiff_t>(v.sign);
+    if (size < 1)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
     if (v.sign)
     {
         *result++ = '-';
     }
 
     unsigned_128_type output = v.mantissa;
-    const auto r = to_chars_128integer_impl(result, result + result_size, output);
+    const auto r = to_chars_128integer_impl(result, result + size, output);
     if (r.ec != std::errc())
     {
         return -static_cast<int>(r.ec);
@@ -400,7 +412,7 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
     {
         // Option 2: Append 0s to the end of the number until we get the proper significand value
         // Then we need precison worth of zeros after the decimal point as applicable
-        if (current_len + v.exponent > result_size)
+        if (current_len + v.exponent > size)
         {
             return -static_cast<int>(std::errc::value_too_large);
         }
@@ -409,27 +421,37 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
         memset(result, '0', static_cast<std::size_t>(v.exponent));
         result += static_cast<std::size_t>(v.exponent);
         current_len += v.exponent;
-        *result++ = '.';
-        ++precision;
+
+        if (precision > 0)
+        {
+            if (current_len + 1 > size)
+            {
+                return -static_cast<int>(std::errc::value_too_large);
+            }
+
+            *result++ = '.';
+            ++current_len;
+        }
     }
     else if ((-v.exponent) < current_len)
     {
         // Option 3: Insert a decimal point into the middle of the existing number
-        if (current_len + v.exponent + 1 > result_size)
+        if (current_len + 1 > size)
         {
-            return -static_cast<int>(std::errc::result_out_of_range);
+            return -static_cast<int>(std::errc::value_too_large);
         }
 
         memmove(result + current_len + v.exponent + 1, result + current_len + v.exponent, static_cast<std::size_t>(-v.exponent));
         memcpy(result + current_len + v.exponent, ".", 1U);
         ++current_len;
-        precision -= current_len + v.exponent;
-        result += current_len + v.exponent + 1;
+        // The fraction already has -v.exponent digits, and is padded at the end of the text
+        precision += v.exponent;
+        result += current_len;
     }
     else
     {
         // Option 4: Leading 0s
-        if (-v.exponent + 2 > result_size)
+        if (-v.exponent + 2 > size)
         {
             return -static_cast<int>(std::errc::value_too_large);
         }
@@ -444,9 +466,9 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
 
     if (precision > 0)
     {
-        if (current_len + precision > result_size)
+        if (current_len + precision > size)
         {
-            return -static_cast<int>(std::errc::result_out_of_range);
+            return -static_cast<int>(std::errc::value_too_large);
         }
 
         memset(result, '0', static_cast<std::size_t>(precision));
@@ -463,12 +485,12 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
 // Maximal char buffer requirement:
 // sign + mantissa digits + decimal dot + 'E' + exponent sign + exponent digits
 // = 1 + 39 + 1 + 1 + 1 + 10 = 53
-static inline int generic_to_chars(const struct floating_decimal_128 v, char* result, const ptrdiff_t result_size, 
+static inline int generic_to_chars(const struct floating_decimal_128 v, char* first, const ptrdiff_t result_size, 
                                    chars_format fmt = chars_format::general, int precision = -1) noexcept
 {
     if (v.exponent == fd128_exceptional_exponent)
     {
-        return copy_special_str(result, result_size, v);
+        return copy_special_str(first, result_size, v);
     }
 
     unsigned_128_type output = v.mantissa;
@@ -486,22 +508,28 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
         const int64_t exp = v.exponent + static_cast<int64_t>(olength);
         if (std::abs(exp) <= olength)
         {
-            return generic_to_chars_fixed(v, result, result_size, precision);
+            // The precision counts significant digits with trailing zeros removed, so the shortest digits
+            // are printed as is when they fit, and need rounding that fixed does not do when they do not
+            if (precision != -1 && static_cast<uint32_t>(precision) < olength)
+            {
+                return -2;
+            }
+
+            return generic_to_chars_fixed(v, first, result_size, -1);
         }
     }
 
     // Step 5: Print the decimal representation.
+    // The digits are rounded to the precision in place, so the number is written into a buffer of the
+    // maximal size, and only copied to first once its length is known
+    char result[64];
     size_t index = 0;
     if (v.sign)
     {
         result[index++] = '-';
     }
 
-    if (index + olength > static_cast<size_t>(result_size))
-    {
-        return -static_cast<int>(std::errc::value_too_large);
-    }
-    else if (olength == 0)
+    if (olength == 0)
     {
         return -2; // Something has gone horribly wrong
     }
@@ -526,6 +554,8 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
         ++index;
     }
 
+    const size_t digits_end = index;
+
     // Reset the index to where the required precision should be
     if (precision != -1)
     {
@@ -564,6 +594,11 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
             // If the last digit is a zero than overwrite that as well, but not in scientific formatting
             if (fmt != chars_format::scientific)
             {
+                if (index > digits_end)
+                {
+                    index = digits_end;
+                }
+
                 while (result[index - 1] == '0')
                 {
                     --index;
@@ -571,10 +606,13 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
             }
             else
             {
-                // In scientific formatting we may need a final 0 to achieve the correct precision
+                // In scientific formatting we may need final 0s to achieve the correct precision
                 if (precision + 1 > static_cast<int>(olength))
                 {
-                    result[index - 1] = '0';
+                    for (size_t i = digits_end; i < index; ++i)
+                    {
+                        result[i] = '0';
+                    }
                 }
             }
         }
@@ -619,6 +657,13 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
     }
     
     index += elength;
+
+    if (index > static_cast<size_t>(result_size))
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    std::memcpy(first, result, index);
     return static_cast<int>(index);
 }
 
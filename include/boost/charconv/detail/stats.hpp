@@ -0,0 +1,125 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_STATS_HPP
+#define BOOST_CHARCONV_DETAIL_STATS_HPP
+
+#include <boost/charconv/stats.hpp>
+#include <boost/charconv/config.hpp>
+
+#if defined(BOOST_CHARCONV_ENABLE_STATS_TIMING) && !defined(BOOST_CHARCONV_ENABLE_STATS)
+#  define BOOST_CHARCONV_ENABLE_STATS
+#endif
+
+#ifdef BOOST_CHARCONV_ENABLE_STATS
+
+#ifdef BOOST_CHARCONV_ENABLE_STATS_TIMING
+#  include <chrono>
+#endif
+
+namespace boost { namespace charconv { namespace detail {
+
+// Counters of the calling thread
+BOOST_CHARCONV_DECL path_stats& thread_stats() noexcept;
+
+#ifdef BOOST_CHARCONV_ENABLE_STATS_TIMING
+
+// Adds the time until the end of the enclosing scope to the counter
+class stats_timer
+{
+private:
+    std::uint64_t& ns_;
+    std::chrono::steady_clock::time_point start_;
+
+    bool running_ {true};
+
+public:
+    explicit stats_timer(std::uint64_t& ns) noexcept : ns_ {ns}, start_ {std::chrono::steady_clock::now()} {}
+
+    stats_timer(const stats_timer&) = delete;
+    stats_timer& operator=(const stats_timer&) = delete;
+
+    // Drops the time measured so far
+    void cancel() noexcept
+    {
+        running_ = false;
+    }
+
+    ~stats_timer() noexcept
+    {
+        if (running_)
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            ns_ += static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+};
+
+#endif // BOOST_CHARCONV_ENABLE_STATS_TIMING
+
+// Counts a conversion in a tier that may give up on the value, and with timing adds its time,
+// at the end of the enclosing scope. After fallback() the tier the value is handed to counts it instead.
+class stats_tier_attempt
+{
+private:
+    std::uint64_t& count_;
+    #ifdef BOOST_CHARCONV_ENABLE_STATS_TIMING
+    stats_timer timer_;
+    #endif
+    bool fallback_ {false};
+
+public:
+    #ifdef BOOST_CHARCONV_ENABLE_STATS_TIMING
+    stats_tier_attempt(std::uint64_t& count, std::uint64_t& ns) noexcept : count_ {count}, timer_ {ns} {}
+    #else
+    stats_tier_attempt(std::uint64_t& count, std::uint64_t&) noexcept : count_ {count} {}
+    #endif
+
+    stats_tier_attempt(const stats_tier_attempt&) = delete;
+    stats_tier_attempt& operator=(const stats_tier_attempt&) = delete;
+
+    void fallback() noexcept
+    {
+        fallback_ = true;
+        #ifdef BOOST_CHARCONV_ENABLE_STATS_TIMING
+        timer_.cancel();
+        #endif
+    }
+
+    ~stats_tier_attempt() noexcept
+    {
+        if (!fallback_)
+        {
+            ++count_;
+        }
+    }
+};
+
+}}} // Namespaces
+
+#  define BOOST_CHARCONV_STATS_COUNT(counter) (++boost::charconv::detail::thread_stats().counter)
+
+#  ifdef BOOST_CHARCONV_ENABLE_STATS_TIMING
+#    define BOOST_CHARCONV_STATS_TIER(tier) BOOST_CHARCONV_STATS_COUNT(tier); \
+         const boost::charconv::detail::stats_timer boost_charconv_stats_timer {boost::charconv::detail::thread_stats().tier##_ns}
+#  else
+#    define BOOST_CHARCONV_STATS_TIER(tier) BOOST_CHARCONV_STATS_COUNT(tier)
+#  endif
+
+// For a tier that can fall back to another one, which then counts the conversion in its place
+#  define BOOST_CHARCONV_STATS_TIER_ATTEMPT(tier) \
+       boost::charconv::detail::stats_tier_attempt boost_charconv_stats_attempt {boost::charconv::detail::thread_stats().tier, \
+                                                                                 boost::charconv::detail::thread_stats().tier##_ns}
+#  define BOOST_CHARCONV_STATS_FALLBACK() boost_charconv_stats_attempt.fallback()
+
+#else
+
+#  define BOOST_CHARCONV_STATS_COUNT(counter) static_cast<void>(0)
+#  define BOOST_CHARCONV_STATS_TIER(tier) static_cast<void>(0)
+#  define BOOST_CHARCONV_STATS_TIER_ATTEMPT(tier) static_cast<void>(0)
+#  define BOOST_CHARCONV_STATS_FALLBACK() static_cast<void>(0)
+
+#endif // BOOST_CHARCONV_ENABLE_STATS
+
+#endif // BOOST_CHARCONV_DETAIL_STATS_HPP
@@ -0,0 +1,78 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_SWAR_DIGITS_HPP
+#define BOOST_CHARCONV_DETAIL_SWAR_DIGITS_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/config.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+#include <cstring>
+
+// Eight decimal digits at a time in a 64-bit word, shared by the integer parser and fast_float.
+// The word holds the characters in memory order, so the first one is in the least significant byte.
+
+namespace boost { namespace charconv { namespace detail {
+
+static constexpr std::uint32_t powers_of_ten_uint32[] = {1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U};
+
+// Loads 8 characters so that the first character is in the least significant byte
+inline std::uint64_t read_eight_chars(const char* first) noexcept
+{
+    std::uint64_t val;
+    std::memcpy(&val, first, sizeof(val));
+
+    #if BOOST_CHARCONV_ENDIAN_BIG_BYTE
+    val = ((val & UINT64_C(0xFF00000000000000)) >> 56) | ((val & UINT64_C(0x00FF000000000000)) >> 40) |
+          ((val & UINT64_C(0x0000FF0000000000)) >> 24) | ((val & UINT64_C(0x000000FF00000000)) >> 8)  |
+          ((val & UINT64_C(0x00000000FF000000)) << 8)  | ((val & UINT64_C(0x0000000000FF0000)) << 24) |
+          ((val & UINT64_C(0x000000000000FF00)) << 40) | ((val & UINT64_C(0x00000000000000FF)) << 56);
+    #endif
+
+    return val;
+}
+
+// The high bit of every byte of val that is not a decimal digit (credit @aqrit).
+// Bytes below the first flagged one never carry or borrow, so the lowest flagged byte is exact.
+constexpr std::uint64_t non_decimal_digits(std::uint64_t val) noexcept
+{
+    return ((val + UINT64_C(0x4646464646464646)) | (val - UINT64_C(0x3030303030303030))) & UINT64_C(0x8080808080808080);
+}
+
+// Number of leading characters in val that are decimal digits (0-8)
+BOOST_CHARCONV_CXX14_CONSTEXPR std::uint32_t leading_decimal_digits(std::uint64_t val) noexcept
+{
+    const std::uint64_t non_digits = non_decimal_digits(val);
+    return non_digits == 0 ? 8U : static_cast<std::uint32_t>(boost::core::countr_zero(non_digits)) / 8U;
+}
+
+// Value of the eight decimal digits in val (credit @aqrit)
+BOOST_CHARCONV_CXX14_CONSTEXPR std::uint32_t parse_eight_decimal_digits(std::uint64_t val) noexcept
+{
+    constexpr std::uint64_t mask = UINT64_C(0x000000FF000000FF);
+    constexpr std::uint64_t mul1 = UINT64_C(0x000F424000000064); // 100 + (1000000ULL << 32)
+    constexpr std::uint64_t mul2 = UINT64_C(0x0000271000000001); // 1 + (10000ULL << 32)
+    val -= UINT64_C(0x3030303030303030);
+    val = (val * 10) + (val >> 8); // val = (val * 2561) >> 8;
+    val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+    return static_cast<std::uint32_t>(val);
+}
+
+// Value of the first n (1-8) decimal digits in val
+BOOST_CHARCONV_CXX14_CONSTEXPR std::uint32_t parse_leading_decimal_digits(std::uint64_t val, std::uint32_t n) noexcept
+{
+    if (n < 8)
+    {
+        // Shift the digits to the top and pad the bottom with '0' so that they read as an 8 digit number
+        const std::uint32_t shift = 8 * (8 - n);
+        val = (val << shift) | (UINT64_C(0x3030303030303030) >> (64 - shift));
+    }
+
+    return parse_eight_decimal_digits(val);
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_SWAR_DIGITS_HPP
@@ -76,13 +76,31 @@ BOOST_CHARCONV_CONSTEXPR char* decompose32(std::uint32_t value, char* buffer) no
     return buffer + 10;
 }
 
+// Digits are formatted into char buffers and then copied to the output. For wider code units the
+// copy zero extends them, which compilers vectorize, so the output is still written once.
+BOOST_CHARCONV_CONSTEXPR void copy_digits(char* dest, const char* src, std::size_t count) noexcept
+{
+    boost::charconv::detail::memcpy(dest, src, count);
+}
+
+template <typename UC>
+BOOST_CHARCONV_CONSTEXPR void copy_digits(UC* dest, const char* src, std::size_t count) noexcept
+{
+    static_assert(sizeof(UC) == 2 || sizeof(UC) == 4, "Code units must be 8, 16 or 32 bits");
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        dest[i] = static_cast<UC>(static_cast<unsigned char>(src[i]));
+    }
+}
+
 #ifdef BOOST_MSVC
 # pragma warning(push)
 # pragma warning(disable: 4127 4146)
 #endif
 
-template <typename Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char* last, Integer value) noexcept
+template <typename Integer, typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars_integer_impl(UC* first, UC* last, Integer value) noexcept
 {
     using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
     Unsigned_Integer unsigned_value {};
@@ -128,7 +146,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         const auto converted_value = static_cast<std::uint32_t>(unsigned_value);
         converted_value_digits = num_digits(converted_value);
 
-        if (converted_value_digits > user_buffer_size)
+        if (converted_value_digits + static_cast<int>(is_negative) > user_buffer_size)
         {
             return {last, std::errc::value_too_large};
         }
@@ -137,10 +155,10 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
 
         if (is_negative)
         {
-            *first++ = '-';
+            *first++ = UC('-');
         }
 
-        boost::charconv::detail::memcpy(first, buffer + (sizeof(buffer) - static_cast<unsigned>(converted_value_digits)),
+        copy_digits(first, buffer + (sizeof(buffer) - static_cast<unsigned>(converted_value_digits)),
                                         static_cast<std::size_t>(converted_value_digits));
     }
     else if (std::numeric_limits<Integer>::digits <= std::numeric_limits<std::uint64_t>::digits ||
@@ -149,14 +167,14 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
         auto converted_value = static_cast<std::uint64_t>(unsigned_value);
         converted_value_digits = num_digits(converted_value);
 
-        if (converted_value_digits > user_buffer_size)
+        if (converted_value_digits + static_cast<int>(is_negative) > user_buffer_size)
         {
             return {last, std::errc::value_too_large};
         }
 
         if (is_negative)
         {
-            *first++ = '-';
+            *first++ = UC('-');
         }
 
         // Only store 9 digits in each to avoid overflow
@@ -167,11 +185,11 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
             const int first_value_chars = num_digits(x);
 
             decompose32(x, buffer);
-            boost::charconv::detail::memcpy(first, buffer + (sizeof(buffer) - static_cast<unsigned>(first_value_chars)),
+            copy_digits(first, buffer + (sizeof(buffer) - static_cast<unsigned>(first_value_chars)),
                                             static_cast<std::size_t>(first_value_chars));
 
             decompose32(y, buffer);
-            boost::charconv::detail::memcpy(first + first_value_chars, buffer + 1, sizeof(buffer) - 1);
+            copy_digits(first + first_value_chars, buffer + 1, sizeof(buffer) - 1);
         }
         else
         {
@@ -183,24 +201,24 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
             if (converted_value_digits == 19)
             {
                 decompose32(x, buffer);
-                boost::charconv::detail::memcpy(first, buffer + 2, sizeof(buffer) - 2);
+                copy_digits(first, buffer + 2, sizeof(buffer) - 2);
 
                 decompose32(y, buffer);
-                boost::charconv::detail::memcpy(first + 8, buffer + 1, sizeof(buffer) - 1);
+                copy_digits(first + 8, buffer + 1, sizeof(buffer) - 1);
 
                 // Always prints 2 digits last
-                boost::charconv::detail::memcpy(first + 17, radix_table + z * 2, 2);
+                copy_digits(first + 17, radix_table + z * 2, 2);
             }
             else // 20
             {
                 decompose32(x, buffer);
-                boost::charconv::detail::memcpy(first, buffer + 1, sizeof(buffer) - 1);
+                copy_digits(first, buffer + 1, sizeof(buffer) - 1);
 
                 decompose32(y, buffer);
-                boost::charconv::detail::memcpy(first + 9, buffer + 1, sizeof(buffer) - 1);
+                copy_digits(first + 9, buffer + 1, sizeof(buffer) - 1);
 
                 // Always prints 2 digits last
-                boost::charconv::detail::memcpy(first + 18, radix_table + z * 2, 2);
+                copy_digits(first + 18, radix_table + z * 2, 2);
             }
         }
     }
@@ -213,8 +231,8 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
 // to extract the digits
 //
 // See: https://quuxplusone.github.io/blog/2019/02/28/is-int128-integral/
-template <typename Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_128integer_impl(char* first, char* last, Integer value) noexcept
+template <typename Integer, typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars_128integer_impl(UC* first, UC* last, Integer value) noexcept
 {
     #ifdef BOOST_CHARCONV_HAS_INT128
     using Unsigned_Integer = boost::uint128_type;
@@ -256,20 +274,20 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_128integer_impl(char* first, c
 
     const int converted_value_digits = num_digits(converted_value);
 
-    if (converted_value_digits > user_buffer_size)
+    if (converted_value_digits + static_cast<int>(is_negative) > user_buffer_size)
     {
         return {last, std::errc::value_too_large};
     }
 
     if (is_negative)
     {
-        *first++ = '-';
+        *first++ = UC('-');
     }
 
     // If the value fits into 64 bits use the other method of processing
     if (converted_value < (std::numeric_limits<std::uint64_t>::max)())
     {
-        return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(value));
+        return to_chars_integer_impl(first, last, static_cast<std::uint64_t>(converted_value));
     }
 
     constexpr std::uint32_t ten_9 = UINT32_C(1000000000);
@@ -288,12 +306,12 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_128integer_impl(char* first, c
 
     --i;
     auto offset = static_cast<std::size_t>(num_chars[i]);
-    boost::charconv::detail::memcpy(first, buffer[i] + 10 - offset, offset);
+    copy_digits(first, buffer[i] + 10 - offset, offset);
 
     while (i > 0)
     {
         --i;
-        boost::charconv::detail::memcpy(first + offset, buffer[i] + 1, 9);
+        copy_digits(first + offset, buffer[i] + 1, 9);
         offset += 9;
     }
 
@@ -311,19 +329,23 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_128integer_impl(char* first, c
 
 // All other bases
 // Use a simple lookup table to put together the Integer in character form
-template <typename Integer, typename Unsigned_Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char* last, Integer value, int base) noexcept
+template <typename Integer, typename Unsigned_Integer, typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars_integer_impl(UC* first, UC* last, Integer value, int base) noexcept
 {
-    const std::ptrdiff_t output_length = last - first;
-
     if (!((first <= last) && (base >= 2 && base <= 36)))
     {
         return {last, std::errc::invalid_argument};
     }
 
+    // There is at least one character, which is either the sign or a digit
+    if (first == last)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
     if (value == 0)
     {
-        *first++ = '0';
+        *first++ = UC('0');
         return {first, std::errc()};
     }
 
@@ -334,7 +356,7 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
     {
         if (value < 0)
         {
-            *first++ = '-';
+            *first++ = UC('-');
             unsigned_value = static_cast<Unsigned_Integer>(detail::apply_sign(value));
         }
         else
@@ -407,12 +429,12 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
 
     const std::ptrdiff_t num_chars = buffer_end - end - 1;
 
-    if (num_chars > output_length)
+    if (num_chars > last - first)
     {
         return {last, std::errc::value_too_large};
     }
 
-    boost::charconv::detail::memcpy(first, buffer + (buffer_size - static_cast<unsigned long>(num_chars)),
+    copy_digits(first, buffer + (buffer_size - static_cast<unsigned long>(num_chars)),
                                     static_cast<std::size_t>(num_chars));
 
     return {first + num_chars, std::errc()};
@@ -428,8 +450,8 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_integer_impl(char* first, char
 # pragma warning(pop)
 #endif
 
-template <typename Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_int(char* first, char* last, Integer value, int base = 10) noexcept
+template <typename Integer, typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars_int(UC* first, UC* last, Integer value, int base = 10) noexcept
 {
     using Unsigned_Integer = typename std::make_unsigned<Integer>::type;
     if (base == 10)
@@ -441,8 +463,8 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars_int(char* first, char* last, I
 }
 
 #ifdef BOOST_CHARCONV_HAS_INT128
-template <typename Integer>
-BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars128(char* first, char* last, Integer value, int base = 10) noexcept
+template <typename Integer, typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars128(UC* first, UC* last, Integer value, int base = 10) noexcept
 {
     if (base == 10)
     {
@@ -453,6 +475,27 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars128(char* first, char* last, In
 }
 #endif
 
+// Dispatch of the overloads that are templated on the integer type
+template <typename Integer, typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars_any_int(UC* first, UC* last, Integer value, int base) noexcept
+{
+    return to_chars_int(first, last, value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+template <typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars_any_int(UC* first, UC* last, boost::int128_type value, int base) noexcept
+{
+    return to_chars128(first, last, value, base);
+}
+
+template <typename UC>
+BOOST_CHARCONV_CONSTEXPR to_chars_result_t<UC> to_chars_any_int(UC* first, UC* last, boost::uint128_type value, int base) noexcept
+{
+    return to_chars128(first, last, value, base);
+}
+#endif
+
 }}} // Namespaces
 
 #endif //BOOST_CHARCONV_DETAIL_TO_CHARS_INTEGER_IMPL_HPP
@@ -49,6 +49,30 @@ struct make_unsigned<boost::uint128_type> { using type = boost::uint128_type; };
 template <typename T>
 using make_unsigned_t = typename make_unsigned<T>::type;
 
+// The integer types of the from_chars overloads, which to_chars takes as well.
+// The character types other than char are integral, but there are no overloads for them.
+template <typename T>
+struct is_from_chars_integer : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                                            !std::is_same<T, wchar_t>::value && !std::is_same<T, char16_t>::value &&
+                                                            !std::is_same<T, char32_t>::value> {};
+
+#ifdef __cpp_char8_t
+
+template <>
+struct is_from_chars_integer<char8_t> : std::false_type {};
+
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+template <>
+struct is_from_chars_integer<boost::int128_type> : std::true_type {};
+
+template <>
+struct is_from_chars_integer<boost::uint128_type> : std::true_type {};
+
+#endif
+
 template <typename T>
 struct make_signed { using type = typename std::make_signed<T>::type; };
 
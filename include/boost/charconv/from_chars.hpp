@@ -14,6 +14,8 @@
 #include <boost/charconv/chars_format.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <system_error>
+#include <type_traits>
+#include <cstddef>
 
 namespace boost { namespace charconv {
 
@@ -237,7 +239,117 @@ BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, st
 BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Wide characters
+//----------------------------------------------------------------------------------------------------------------------
+
+// Text in char16_t (UTF-16), char32_t (UTF-32) or wchar_t. A number only consists of characters of the
+// basic character set, so the results, including ptr, are those of the char overloads on the same text.
+
+template <typename Integer>
+BOOST_CHARCONV_GCC5_CONSTEXPR typename std::enable_if<detail::is_from_chars_integer<Integer>::value, from_chars_result_t<char16_t>>::type
+from_chars(const char16_t* first, const char16_t* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+}
+template <typename Integer>
+BOOST_CHARCONV_GCC5_CONSTEXPR typename std::enable_if<detail::is_from_chars_integer<Integer>::value, from_chars_result_t<char32_t>>::type
+from_chars(const char32_t* first, const char32_t* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+}
+template <typename Integer>
+BOOST_CHARCONV_GCC5_CONSTEXPR typename std::enable_if<detail::is_from_chars_integer<Integer>::value, from_chars_result_t<wchar_t>>::type
+from_chars(const wchar_t* first, const wchar_t* last, Integer& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<Integer, detail::make_unsigned_t<Integer>>(first, last, value, base);
+}
+
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char16_t> from_chars(const char16_t* first, const char16_t* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<char32_t> from_chars(const char32_t* first, const char32_t* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result_t<wchar_t> from_chars(const wchar_t* first, const wchar_t* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Padded buffers
+//----------------------------------------------------------------------------------------------------------------------
+
+// The from_chars_padded overloads behave exactly like from_chars, but require that at least
+// from_chars_padding bytes past last are readable (e.g. a network buffer with trailing slack).
+// The characters in the padding never influence the result.
+
+BOOST_ATTRIBUTE_UNUSED constexpr std::size_t from_chars_padding = 8;
+
+inline from_chars_result from_chars_padded(const char* first, const char* last, bool& value, int base = 10) noexcept = delete;
+inline from_chars_result from_chars_padded(const char* first, const char* last, char& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, signed char& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned char& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, short& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned short& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, int& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned int& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, long long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, unsigned long long& value, int base = 10) noexcept
+{
+    return detail::from_chars_padded(first, last, value, base);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+inline from_chars_result from_chars_padded(const char* first, const char* last, boost::int128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<boost::int128_type, boost::uint128_type, true>(first, last, value, base);
+}
+inline from_chars_result from_chars_padded(const char* first, const char* last, boost::uint128_type& value, int base = 10) noexcept
+{
+    return detail::from_chars_integer_impl<boost::uint128_type, boost::uint128_type, true>(first, last, value, base);
+}
+#endif
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_padded(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_padded(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_padded(const char* first, const char* last, long double& value, chars_format fmt = chars_format::general) noexcept;
+
 } // namespace charconv
+
 } // namespace boost
 
 #endif // #ifndef BOOST_CHARCONV_FROM_CHARS_HPP_INCLUDED
@@ -0,0 +1,44 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_LOAD_NUMBERS_HPP_INCLUDED
+#define BOOST_CHARCONV_LOAD_NUMBERS_HPP_INCLUDED
+
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <vector>
+#include <cstddef>
+
+namespace boost { namespace charconv {
+
+struct load_result
+{
+    std::size_t count;  // Number of values stored
+    std::size_t offset; // Offset in the file of the first field that was not stored, the size of the file on success
+    std::errc ec;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+// Reads the file at path as numbers separated by delimiter and appends them to out, in order.
+// The file is mapped into memory where the platform allows it and parsed in place with
+// from_chars_padded, so no line or buffer copies are made.
+BOOST_CHARCONV_DECL load_result load_numbers(const char* path, char delimiter, std::vector<float>& out,
+                                             chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL load_result load_numbers(const char* path, char delimiter, std::vector<double>& out,
+                                             chars_format fmt = chars_format::general) noexcept;
+
+// As above, but stores the values in [first, last). A file with more values than fit
+// returns std::errc::value_too_large with the buffer filled.
+BOOST_CHARCONV_DECL load_result load_numbers(const char* path, char delimiter, float* first, float* last,
+                                             chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL load_result load_numbers(const char* path, char delimiter, double* first, double* last,
+                                             chars_format fmt = chars_format::general) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_LOAD_NUMBERS_HPP_INCLUDED
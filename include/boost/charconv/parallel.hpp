@@ -0,0 +1,51 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_PARALLEL_HPP_INCLUDED
+#define BOOST_CHARCONV_PARALLEL_HPP_INCLUDED
+
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <vector>
+
+namespace boost { namespace charconv {
+
+// Parses [first, last) as numbers separated by delimiter and appends them to out, in order.
+// The buffer is split into chunks that start right after a delimiter, which are parsed on up to
+// threads threads (0 for one per hardware thread). The result is the same as that of a loop that
+// calls from_chars for each field and stops at the first one that fails.
+BOOST_CHARCONV_DECL from_chars_result parallel_from_chars(const char* first, const char* last, char delimiter, std::vector<float>& out,
+                                                          unsigned threads = 0, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result parallel_from_chars(const char* first, const char* last, char delimiter, std::vector<double>& out,
+                                                          unsigned threads = 0, chars_format fmt = chars_format::general) noexcept;
+
+template <typename T>
+inline from_chars_result parallel_from_chars(boost::core::string_view sv, char delimiter, std::vector<T>& out,
+                                             unsigned threads = 0, chars_format fmt = chars_format::general) noexcept
+{
+    return parallel_from_chars(sv.data(), sv.data() + sv.size(), delimiter, out, threads, fmt);
+}
+
+// Writes the values in [values_first, values_last) to [first, last), separated by delimiter, exactly
+// as a loop over to_chars would. Slices of the values are formatted on up to threads threads,
+// each into a buffer of its own, and the buffers are then copied into place one after another.
+BOOST_CHARCONV_DECL to_chars_result parallel_to_chars(char* first, char* last, const float* values_first, const float* values_last, char delimiter,
+                                                      unsigned threads = 0, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL to_chars_result parallel_to_chars(char* first, char* last, const double* values_first, const double* values_last, char delimiter,
+                                                      unsigned threads = 0, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL to_chars_result parallel_to_chars(char* first, char* last, const float* values_first, const float* values_last, char delimiter,
+                                                      unsigned threads, chars_format fmt, int precision) noexcept;
+
+BOOST_CHARCONV_DECL to_chars_result parallel_to_chars(char* first, char* last, const double* values_first, const double* values_last, char delimiter,
+                                                      unsigned threads, chars_format fmt, int precision) noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_PARALLEL_HPP_INCLUDED
@@ -0,0 +1,152 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_SCAN_NUMBER_HPP_INCLUDED
+#define BOOST_CHARCONV_SCAN_NUMBER_HPP_INCLUDED
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <type_traits>
+#include <system_error>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+enum class number_kind : unsigned
+{
+    integer,    // Only digits e.g. 42 or -7
+    floating,   // Has a decimal point and/or an exponent e.g. 1.5, 1e10, or 2.
+    infinity,   // inf or infinity
+    nan         // nan or nan(n-char-sequence)
+};
+
+struct scan_result
+{
+    const char* ptr;
+    std::errc ec;
+
+    number_kind kind;
+    bool negative;
+
+    // Number of significant digits (leading zeros are not counted)
+    std::size_t digits;
+
+    // Power of 10 of the leading significant digit, so 1234.5 is 4 and 0.01 is -2.
+    // 0 if the value is zero or not finite.
+    std::int64_t exponent;
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+// Determines the extent and shape of the number at the beginning of [first, last) using the same
+// grammar as from_chars, without converting it to a binary value.
+// chars_format::hex is not supported and returns std::errc::not_supported.
+BOOST_CHARCONV_DECL scan_result scan_number(const char* first, const char* last, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL scan_result scan_number(boost::core::string_view sv, chars_format fmt = chars_format::general) noexcept;
+
+// Result of scanning a number once so that it can be converted later without scanning the digits again.
+// Only valid as long as the buffer it was scanned from is alive.
+struct decimal_token
+{
+    const char* first;
+    std::size_t length;
+
+    // The first 19 significant digits, and the power of 10 they are scaled by
+    std::uint64_t mantissa;
+    std::int64_t exponent;
+
+    std::size_t integer_length;
+    std::size_t fraction_length;
+
+    number_kind kind;
+    bool negative;
+    bool truncated; // More than 19 significant digits
+
+    // Same result as calling from_chars on [first, first + length)
+    // Integral types only accept number_kind::integer
+    template <typename T>
+    from_chars_result to(T& value) const noexcept;
+};
+
+BOOST_CHARCONV_DECL scan_result scan_number(const char* first, const char* last, decimal_token& token, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL scan_result scan_number(boost::core::string_view sv, decimal_token& token, chars_format fmt = chars_format::general) noexcept;
+
+namespace detail {
+
+BOOST_CHARCONV_DECL from_chars_result decimal_token_to(const decimal_token& token, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result decimal_token_to(const decimal_token& token, double& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result decimal_token_to(const decimal_token& token, long double& value) noexcept;
+
+template <typename Integer, typename std::enable_if<std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value, bool>::type = true>
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result decimal_token_to(const decimal_token& token, Integer& value) noexcept
+{
+    if (token.kind != number_kind::integer)
+    {
+        return {token.first, std::errc::invalid_argument};
+    }
+
+    const char* last = token.first + token.length;
+
+    if (!token.truncated && (!token.negative || std::numeric_limits<Integer>::is_signed))
+    {
+        const std::uint64_t max_magnitude = sizeof(Integer) > sizeof(std::uint64_t) ? UINT64_MAX :
+            static_cast<std::uint64_t>((std::numeric_limits<Integer>::max)()) + static_cast<std::uint64_t>(token.negative);
+
+        if (token.mantissa <= max_magnitude)
+        {
+            if (!token.negative || token.mantissa == 0)
+            {
+                value = static_cast<Integer>(token.mantissa);
+            }
+            else
+            {
+                value = static_cast<Integer>(static_cast<Integer>(0) - static_cast<Integer>(token.mantissa - 1) - 1);
+            }
+
+            return {last, std::errc()};
+        }
+    }
+
+    // Out of range, or negative for an unsigned type
+    return boost::charconv::from_chars(token.first, last, value);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result decimal_token_to(const decimal_token& token, boost::int128_type& value) noexcept
+{
+    if (token.kind != number_kind::integer)
+    {
+        return {token.first, std::errc::invalid_argument};
+    }
+
+    return boost::charconv::from_chars(token.first, token.first + token.length, value);
+}
+
+BOOST_CHARCONV_GCC5_CONSTEXPR from_chars_result decimal_token_to(const decimal_token& token, boost::uint128_type& value) noexcept
+{
+    if (token.kind != number_kind::integer)
+    {
+        return {token.first, std::errc::invalid_argument};
+    }
+
+    return boost::charconv::from_chars(token.first, token.first + token.length, value);
+}
+#endif
+
+} // Namespace detail
+
+template <typename T>
+inline from_chars_result decimal_token::to(T& value) const noexcept
+{
+    return detail::decimal_token_to(*this, value);
+}
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_SCAN_NUMBER_HPP_INCLUDED
@@ -0,0 +1,46 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_STATS_HPP_INCLUDED
+#define BOOST_CHARCONV_STATS_HPP_INCLUDED
+
+#include <boost/charconv/config.hpp>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+// Number of conversions handled by each tier of the floating point algorithms on the calling thread.
+// The counters are only updated when the library is compiled with BOOST_CHARCONV_ENABLE_STATS,
+// and the times only with BOOST_CHARCONV_ENABLE_STATS_TIMING, otherwise they are always zero.
+struct path_stats
+{
+    // from_chars
+    std::uint64_t clinger;          // Exact fast path, the significand and power of 10 are both exact doubles
+    std::uint64_t eisel_lemire;     // 128-bit multiplication by a truncated power of 5
+    std::uint64_t bigint;           // Arbitrary precision comparison against the halfway point
+    std::uint64_t strtod;           // Fallback to the C library
+
+    // to_chars
+    std::uint64_t integer_shortcut; // Integral values too large for the fixed path are printed as integers
+    std::uint64_t fixed;            // Shortest fixed representation of values in [1, 1e16)
+    std::uint64_t dragonbox;        // Shortest representation
+    std::uint64_t floff;            // Specified precision
+    std::uint64_t ryu;              // 80 and 128-bit types
+    std::uint64_t printf;           // Fallback to the C library
+
+    // Cumulative nanoseconds spent in each to_chars tier
+    std::uint64_t integer_shortcut_ns;
+    std::uint64_t fixed_ns;
+    std::uint64_t dragonbox_ns;
+    std::uint64_t floff_ns;
+    std::uint64_t ryu_ns;
+    std::uint64_t printf_ns;
+};
+
+BOOST_CHARCONV_DECL path_stats stats() noexcept;
+BOOST_CHARCONV_DECL void reset_stats() noexcept;
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_STATS_HPP_INCLUDED
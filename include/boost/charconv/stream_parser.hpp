@@ -0,0 +1,300 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_STREAM_PARSER_HPP_INCLUDED
+#define BOOST_CHARCONV_STREAM_PARSER_HPP_INCLUDED
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_integer_impl.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <type_traits>
+#include <system_error>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+namespace detail {
+
+// Everything a floating point number that is split across chunks carries over to the next call.
+// The significant digits are kept as text because the inputs that need the big integer
+// comparison are rounded from all of them, not only from the first 19.
+struct float_stream_state
+{
+    // fast_float reads at most this many significant digits of a double, anything past
+    // them only matters as far as it is zero or not
+    static constexpr std::size_t max_digits = 769;
+
+    // Characters from earlier chunks that may turn out not to be part of the number,
+    // e.g. the e of 1e when the next chunk does not start with a digit
+    static constexpr std::size_t max_held = 32;
+
+    chars_format fmt;
+    unsigned phase;
+    unsigned kind;
+    unsigned word;              // Letters of inf, infinity, or nan matched so far
+    bool negative;
+    bool saw_digit;
+    bool sticky;                // A non-zero digit after the first max_digits
+    bool exp_negative;
+    bool held_overflow;
+    std::int64_t decimal_point; // Power of 10 of the first significant digit, plus 1
+    std::uint64_t significant;  // Number of significant digits, including the ones not stored
+    std::int64_t exp_number;
+    std::size_t held_length;
+    char held[max_held];
+
+    // The significant digits, and room for a digit standing in for the ones after max_digits
+    char digits[max_digits + 1];
+
+    void clear() noexcept
+    {
+        phase = 0;
+        kind = 0;
+        word = 0;
+        negative = false;
+        saw_digit = false;
+        sticky = false;
+        exp_negative = false;
+        decimal_point = 0;
+        significant = 0;
+        exp_number = 0;
+    }
+};
+
+BOOST_CHARCONV_DECL from_chars_result stream_feed(float_stream_state& state, const char* first, const char* last, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result stream_feed(float_stream_state& state, const char* first, const char* last, double& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result stream_feed(float_stream_state& state, const char* first, const char* last, long double& value) noexcept;
+
+BOOST_CHARCONV_DECL from_chars_result stream_finish(float_stream_state& state, float& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result stream_finish(float_stream_state& state, double& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result stream_finish(float_stream_state& state, long double& value) noexcept;
+
+template <typename T>
+struct is_stream_float
+{
+    static constexpr bool value = std::is_same<T, float>::value || std::is_same<T, double>::value || std::is_same<T, long double>::value;
+};
+
+// The integer types from_chars takes
+template <typename T>
+struct is_stream_integer
+{
+    static constexpr bool value = is_from_chars_integer<T>::value;
+};
+
+} // Namespace detail
+
+// Parses one number at a time from input that arrives in chunks, e.g. network segments or
+// the two halves of a wrapped ring buffer. A number cut at the end of a chunk is kept
+// in the parser until the chunk that completes it arrives, so nothing has to be copied
+// into a scratch buffer and no prefix of the number is ever returned as a shorter value.
+template <typename T, typename Enable = void>
+class stream_parser;
+
+template <typename T>
+class stream_parser<T, typename std::enable_if<detail::is_stream_float<T>::value>::type>
+{
+    detail::float_stream_state state_;
+
+public:
+
+    explicit stream_parser(chars_format fmt = chars_format::general) noexcept
+    {
+        state_.fmt = fmt;
+        reset();
+    }
+
+    // Continues the current number with [first, last)
+    from_chars_result feed(const char* first, const char* last, T& value) noexcept
+    {
+        return detail::stream_feed(state_, first, last, value);
+    }
+
+    from_chars_result feed(boost::core::string_view sv, T& value) noexcept
+    {
+        return feed(sv.data(), sv.data() + sv.size(), value);
+    }
+
+    // Completes the current number at the end of the input
+    from_chars_result finish(T& value) noexcept
+    {
+        return detail::stream_finish(state_, value);
+    }
+
+    // True if part of a number has been consumed
+    bool pending() const noexcept
+    {
+        return state_.phase != 0;
+    }
+
+    // Characters of earlier chunks that followed the last number without being part of it
+    boost::core::string_view leftover() const noexcept
+    {
+        return pending() ? boost::core::string_view() : boost::core::string_view(state_.held, state_.held_length);
+    }
+
+    void reset() noexcept
+    {
+        state_.clear();
+        state_.held_overflow = false;
+        state_.held_length = 0;
+    }
+};
+
+template <typename T>
+class stream_parser<T, typename std::enable_if<detail::is_stream_integer<T>::value>::type>
+{
+    using unsigned_type = detail::make_unsigned_t<T>;
+
+    enum : unsigned { phase_start, phase_sign, phase_digits };
+
+    unsigned_type magnitude_;
+    int base_;
+    unsigned phase_;
+    bool negative_;
+    bool overflowed_;
+
+    from_chars_result complete(const char* ptr, T& value) noexcept
+    {
+        const unsigned_type magnitude = magnitude_;
+        const bool negative = negative_;
+        const bool overflowed = overflowed_;
+        reset();
+
+        if (overflowed)
+        {
+            return {ptr, std::errc::result_out_of_range};
+        }
+
+        value = negative ? static_cast<T>(static_cast<unsigned_type>(0) - magnitude) : static_cast<T>(magnitude);
+        return {ptr, std::errc()};
+    }
+
+public:
+
+    explicit stream_parser(int base = 10) noexcept : base_(base)
+    {
+        reset();
+    }
+
+    from_chars_result feed(const char* first, const char* last, T& value) noexcept
+    {
+        if (base_ < 2 || base_ > 36)
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        // A number that ends inside the chunk is parsed in one go
+        if (phase_ == phase_start && first != last)
+        {
+            T temp_value {};
+            const auto r = boost::charconv::from_chars(first, last, temp_value, base_);
+
+            // A sign at the end of the chunk is invalid_argument too, but the digits can be in the next one
+            if (r.ec != std::errc::invalid_argument && r.ptr != last)
+            {
+                if (r)
+                {
+                    value = temp_value;
+                }
+
+                return r;
+            }
+        }
+
+        const auto base = static_cast<unsigned_type>(base_);
+
+        for (const char* p = first; p != last; ++p)
+        {
+            if (phase_ == phase_start)
+            {
+                phase_ = phase_sign;
+
+                if (detail::is_signed<T>::value && *p == '-')
+                {
+                    negative_ = true;
+                    continue;
+                }
+            }
+
+            const unsigned char digit = detail::digit_from_char(*p);
+
+            if (digit >= base)
+            {
+                if (phase_ != phase_digits)
+                {
+                    reset();
+                    return {first, std::errc::invalid_argument};
+                }
+
+                return complete(p, value);
+            }
+
+            phase_ = phase_digits;
+
+            // Without numeric_limits, which only knows the 128-bit integers in the GNU dialects
+            const auto unsigned_max = static_cast<unsigned_type>(~static_cast<unsigned_type>(0));
+            unsigned_type limit = detail::is_signed<T>::value ? static_cast<unsigned_type>(unsigned_max >> 1) : unsigned_max;
+            if (negative_)
+            {
+                ++limit;
+            }
+
+            if (magnitude_ > static_cast<unsigned_type>((limit - digit) / base))
+            {
+                overflowed_ = true;
+            }
+            else
+            {
+                magnitude_ = static_cast<unsigned_type>(magnitude_ * base + digit);
+            }
+        }
+
+        return {last, std::errc::resource_unavailable_try_again};
+    }
+
+    from_chars_result feed(boost::core::string_view sv, T& value) noexcept
+    {
+        return feed(sv.data(), sv.data() + sv.size(), value);
+    }
+
+    from_chars_result finish(T& value) noexcept
+    {
+        if (phase_ != phase_digits)
+        {
+            reset();
+            return {nullptr, std::errc::invalid_argument};
+        }
+
+        return complete(nullptr, value);
+    }
+
+    bool pending() const noexcept
+    {
+        return phase_ != phase_start;
+    }
+
+    // Integers never look ahead past their last digit
+    boost::core::string_view leftover() const noexcept
+    {
+        return boost::core::string_view();
+    }
+
+    void reset() noexcept
+    {
+        magnitude_ = 0;
+        phase_ = phase_start;
+        negative_ = false;
+        overflowed_ = false;
+    }
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_STREAM_PARSER_HPP_INCLUDED
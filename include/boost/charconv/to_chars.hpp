@@ -9,8 +9,10 @@
 
 #include <boost/charconv/detail/to_chars_integer_impl.hpp>
 #include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <type_traits>
 
 namespace boost {
 namespace charconv {
@@ -135,6 +137,97 @@ BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::bfloa
                                              chars_format fmt, int precision) noexcept;
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Wide characters
+//----------------------------------------------------------------------------------------------------------------------
+
+// Output as char16_t (UTF-16), char32_t (UTF-32) or wchar_t code units, with the same characters and errors as the
+// char overloads. Integers are written directly. Floating point values are formatted on the stack and zero extended
+// as they are stored into [first, last).
+
+template <typename Integer>
+BOOST_CHARCONV_CONSTEXPR typename std::enable_if<detail::is_from_chars_integer<Integer>::value, to_chars_result_t<char16_t>>::type
+to_chars(char16_t* first, char16_t* last, Integer value, int base = 10) noexcept
+{
+    return detail::to_chars_any_int(first, last, value, base);
+}
+template <typename Integer>
+BOOST_CHARCONV_CONSTEXPR typename std::enable_if<detail::is_from_chars_integer<Integer>::value, to_chars_result_t<char32_t>>::type
+to_chars(char32_t* first, char32_t* last, Integer value, int base = 10) noexcept
+{
+    return detail::to_chars_any_int(first, last, value, base);
+}
+template <typename Integer>
+BOOST_CHARCONV_CONSTEXPR typename std::enable_if<detail::is_from_chars_integer<Integer>::value, to_chars_result_t<wchar_t>>::type
+to_chars(wchar_t* first, wchar_t* last, Integer value, int base = 10) noexcept
+{
+    return detail::to_chars_any_int(first, last, value, base);
+}
+
+BOOST_CHARCONV_DECL to_chars_result_t<char16_t> to_chars(char16_t* first, char16_t* last, float value,
+                                                         chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char16_t> to_chars(char16_t* first, char16_t* last, double value,
+                                                         chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char16_t> to_chars(char16_t* first, char16_t* last, long double value,
+                                                         chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char16_t> to_chars(char16_t* first, char16_t* last, float value,
+                                                         chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char16_t> to_chars(char16_t* first, char16_t* last, double value,
+                                                         chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char16_t> to_chars(char16_t* first, char16_t* last, long double value,
+                                                         chars_format fmt, int precision) noexcept;
+
+BOOST_CHARCONV_DECL to_chars_result_t<char32_t> to_chars(char32_t* first, char32_t* last, float value,
+                                                         chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char32_t> to_chars(char32_t* first, char32_t* last, double value,
+                                                         chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char32_t> to_chars(char32_t* first, char32_t* last, long double value,
+                                                         chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char32_t> to_chars(char32_t* first, char32_t* last, float value,
+                                                         chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char32_t> to_chars(char32_t* first, char32_t* last, double value,
+                                                         chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<char32_t> to_chars(char32_t* first, char32_t* last, long double value,
+                                                         chars_format fmt, int precision) noexcept;
+
+BOOST_CHARCONV_DECL to_chars_result_t<wchar_t> to_chars(wchar_t* first, wchar_t* last, float value,
+                                                        chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<wchar_t> to_chars(wchar_t* first, wchar_t* last, double value,
+                                                        chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<wchar_t> to_chars(wchar_t* first, wchar_t* last, long double value,
+                                                        chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<wchar_t> to_chars(wchar_t* first, wchar_t* last, float value,
+                                                        chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<wchar_t> to_chars(wchar_t* first, wchar_t* last, double value,
+                                                        chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_result_t<wchar_t> to_chars(wchar_t* first, wchar_t* last, long double value,
+                                                        chars_format fmt, int precision) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// JSON
+//----------------------------------------------------------------------------------------------------------------------
+
+// What to_chars_json writes for inf and nan, which are not JSON numbers
+enum class json_nonfinite : unsigned
+{
+    error, // Fails with std::errc::invalid_argument
+    null   // Writes null
+};
+
+struct json_options
+{
+    json_nonfinite nonfinite = json_nonfinite::error;
+    bool integer_fraction = false; // Integer valued numbers are written as 3.0 instead of 3, so that readers keep them floating point
+};
+
+// The shortest representation as an RFC 8259 number. The integer overloads of to_chars already write valid JSON.
+BOOST_CHARCONV_DECL to_chars_result to_chars_json(char* first, char* last, float value,
+                                                  const json_options& options = json_options()) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_json(char* first, char* last, double value,
+                                                  const json_options& options = json_options()) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_json(char* first, char* last, long double value,
+                                                  const json_options& options = json_options()) noexcept;
+
 } // namespace charconv
 } // namespace boost
 
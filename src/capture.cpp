@@ -0,0 +1,160 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/detail/capture.hpp>
+#include <boost/charconv/capture.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <cstddef>
+
+#ifdef BOOST_CHARCONV_ENABLE_CAPTURE
+
+namespace {
+
+constexpr std::size_t capture_capacity = 256;
+constexpr std::size_t capture_max_length = 128;
+
+struct capture_record
+{
+    const char* kind;
+    const char* type;
+    int fmt;
+    int precision;
+    bool is_value;
+    std::size_t length;
+    unsigned char data[capture_max_length];
+};
+
+// Each thread only ever writes to its own buffer so no synchronization is required.
+// Once full the oldest records are overwritten.
+struct capture_buffer
+{
+    capture_record records[capture_capacity];
+    std::size_t head; // Total number of records since the last drain
+};
+
+thread_local capture_buffer thread_captures {};
+
+capture_record& next_record() noexcept
+{
+    capture_record& record = thread_captures.records[thread_captures.head % capture_capacity];
+    ++thread_captures.head;
+    return record;
+}
+
+// The fallback routines can be handed trailing characters that are not part of the number
+bool is_number_char(char c) noexcept
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           c == '.' || c == '-' || c == '+' || c == '(' || c == ')' || c == '_';
+}
+
+const char* format_name(int fmt) noexcept
+{
+    switch (static_cast<boost::charconv::chars_format>(fmt))
+    {
+        case boost::charconv::chars_format::scientific:
+            return "scientific";
+        case boost::charconv::chars_format::fixed:
+            return "fixed";
+        case boost::charconv::chars_format::hex:
+            return "hex";
+        default:
+            return "general";
+    }
+}
+
+} // Namespace anonymous
+
+void boost::charconv::detail::capture_input(const char* kind, const char* type, const char* first, std::size_t length) noexcept
+{
+    capture_record& record = next_record();
+    record.kind = kind;
+    record.type = type;
+    record.is_value = false;
+    record.fmt = 0;
+    record.precision = -1;
+
+    std::size_t i = 0;
+    while (i < length && i < capture_max_length && is_number_char(first[i]))
+    {
+        record.data[i] = static_cast<unsigned char>(first[i]);
+        ++i;
+    }
+    record.length = i;
+}
+
+void boost::charconv::detail::capture_value(const char* kind, const char* type, const void* value, std::size_t size, int fmt, int precision) noexcept
+{
+    capture_record& record = next_record();
+    record.kind = kind;
+    record.type = type;
+    record.is_value = true;
+    record.fmt = fmt;
+    record.precision = precision;
+    record.length = size < capture_max_length ? size : capture_max_length;
+    std::memcpy(record.data, value, record.length);
+}
+
+boost::charconv::drain_result boost::charconv::drain_captured_inputs(const char* path) noexcept
+{
+    const std::size_t head = thread_captures.head;
+    if (head == 0)
+    {
+        return {0, std::errc()};
+    }
+
+    std::FILE* file = std::fopen(path, "a");
+    if (file == nullptr)
+    {
+        return {0, static_cast<std::errc>(errno)};
+    }
+
+    const std::size_t count = head < capture_capacity ? head : capture_capacity;
+
+    // Oldest to newest
+    for (std::size_t i = head - count; i < head; ++i)
+    {
+        const capture_record& record = thread_captures.records[i % capture_capacity];
+
+        std::fprintf(file, "%s %s ", record.kind, record.type);
+        if (record.is_value)
+        {
+            // Bytes in memory order so the value can be restored with memcpy on the same platform
+            std::fputs("0x", file);
+            for (std::size_t j = 0; j < record.length; ++j)
+            {
+                std::fprintf(file, "%02x", static_cast<unsigned>(record.data[j]));
+            }
+            std::fprintf(file, " %s %d\n", format_name(record.fmt), record.precision);
+        }
+        else
+        {
+            std::fwrite(record.data, 1, record.length, file);
+            std::fputc('\n', file);
+        }
+    }
+
+    thread_captures.head = 0;
+
+    const bool failed = std::ferror(file) != 0;
+    if (std::fclose(file) != 0 || failed)
+    {
+        return {0, std::errc::io_error};
+    }
+
+    return {count, std::errc()};
+}
+
+#else
+
+boost::charconv::drain_result boost::charconv::drain_captured_inputs(const char*) noexcept
+{
+    return {0, std::errc()};
+}
+
+#endif // BOOST_CHARCONV_ENABLE_CAPTURE
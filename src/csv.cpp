@@ -0,0 +1,582 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/csv.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include "to_chars_float_impl.hpp"
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/limits.hpp>
+#include <new>
+#include <limits>
+#include <system_error>
+#include <cerrno>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+namespace {
+
+using boost::charconv::from_chars_result;
+using boost::charconv::chars_format;
+using boost::charconv::csv_options;
+
+// A carriage return only ends the row together with the line feed after it, or at the end of the input
+inline bool is_row_end(const char* p, const char* last) noexcept
+{
+    return p == last || *p == '\n' || (*p == '\r' && (p + 1 == last || p[1] == '\n'));
+}
+
+inline const char* skip_row_end(const char* p, const char* last) noexcept
+{
+    if (p != last && *p == '\r')
+    {
+        ++p;
+    }
+
+    return p == last ? p : p + 1;
+}
+
+template <typename Integer>
+inline from_chars_result parse_value(const char* first, const char* last, Integer& value, chars_format) noexcept
+{
+    return boost::charconv::from_chars(first, last, value);
+}
+
+// The fast_float parser is called directly so that it is inlined into the loop over the fields
+template <typename Float>
+inline from_chars_result parse_float(const char* first, const char* last, Float& value, chars_format fmt) noexcept
+{
+    if (fmt == chars_format::hex)
+    {
+        return boost::charconv::from_chars(first, last, value, fmt);
+    }
+
+    Float temp_value {};
+    const auto r = boost::charconv::detail::fast_float::from_chars(first, last, temp_value, fmt);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+inline from_chars_result parse_value(const char* first, const char* last, float& value, chars_format fmt) noexcept
+{
+    return parse_float(first, last, value, fmt);
+}
+
+inline from_chars_result parse_value(const char* first, const char* last, double& value, chars_format fmt) noexcept
+{
+    return parse_float(first, last, value, fmt);
+}
+
+// Stores the number at p in values[row]. ptr is the end of the field on success.
+// Quotes are only looked for when the field starts with one.
+template <typename T>
+inline from_chars_result parse_field(const char* p, const char* last, void* values, std::size_t row, const csv_options& options) noexcept
+{
+    T value {};
+
+    if (p != last && *p == options.quote)
+    {
+        const void* close = std::memchr(p + 1, options.quote, static_cast<std::size_t>(last - p - 1));
+
+        if (close == nullptr)
+        {
+            return {p, std::errc::invalid_argument};
+        }
+
+        const char* const end = static_cast<const char*>(close);
+        const auto r = parse_value(p + 1, end, value, options.fmt);
+
+        if (!r)
+        {
+            return r;
+        }
+
+        if (r.ptr != end)
+        {
+            return {r.ptr, std::errc::invalid_argument};
+        }
+
+        static_cast<T*>(values)[row] = value;
+        return {end + 1, std::errc()};
+    }
+
+    const auto r = parse_value(p, last, value, options.fmt);
+
+    if (r)
+    {
+        static_cast<T*>(values)[row] = value;
+    }
+
+    return r;
+}
+
+// A quoted field may contain delimiters and line breaks, and a quote is written twice
+from_chars_result skip_field(const char* p, const char* last, const csv_options& options) noexcept
+{
+    if (p != last && *p == options.quote)
+    {
+        const char* const open = p++;
+
+        for (;;)
+        {
+            const void* close = std::memchr(p, options.quote, static_cast<std::size_t>(last - p));
+
+            if (close == nullptr)
+            {
+                return {open, std::errc::invalid_argument};
+            }
+
+            p = static_cast<const char*>(close) + 1;
+
+            if (p == last || *p != options.quote)
+            {
+                return {p, std::errc()};
+            }
+
+            ++p;
+        }
+    }
+
+    while (p != last && *p != options.delimiter && !is_row_end(p, last))
+    {
+        ++p;
+    }
+
+    return {p, std::errc()};
+}
+
+} // Namespace
+
+boost::charconv::csv_result boost::charconv::parse_csv(const char* first, const char* last, const csv_column* columns, std::size_t column_count,
+                                                       std::size_t max_rows, const csv_options& options) noexcept
+{
+    if (column_count == 0)
+    {
+        return {first, 0, 0, std::errc::invalid_argument};
+    }
+
+    const char* p = first;
+
+    if (options.header && p != last)
+    {
+        for (;;)
+        {
+            const auto r = skip_field(p, last, options);
+
+            if (!r)
+            {
+                return {r.ptr, 0, 0, r.ec};
+            }
+
+            p = r.ptr;
+
+            if (p == last || *p != options.delimiter)
+            {
+                break;
+            }
+
+            ++p;
+        }
+
+        if (!is_row_end(p, last))
+        {
+            return {p, 0, 0, std::errc::invalid_argument};
+        }
+
+        p = skip_row_end(p, last);
+    }
+
+    std::size_t row = 0;
+
+    while (p != last)
+    {
+        if (row == max_rows)
+        {
+            return {p, row, 0, std::errc::value_too_large};
+        }
+
+        for (std::size_t column = 0; column < column_count; ++column)
+        {
+            from_chars_result r;
+
+            switch (columns[column].type)
+            {
+                case column_type::int64:
+                    r = parse_field<std::int64_t>(p, last, columns[column].values, row, options);
+                    break;
+                case column_type::uint64:
+                    r = parse_field<std::uint64_t>(p, last, columns[column].values, row, options);
+                    break;
+                case column_type::float32:
+                    r = parse_field<float>(p, last, columns[column].values, row, options);
+                    break;
+                case column_type::float64:
+                    r = parse_field<double>(p, last, columns[column].values, row, options);
+                    break;
+                default:
+                    r = skip_field(p, last, options);
+                    break;
+            }
+
+            if (!r)
+            {
+                return {r.ptr, row, column, r.ec};
+            }
+
+            p = r.ptr;
+
+            if (column + 1 == column_count)
+            {
+                if (!is_row_end(p, last))
+                {
+                    return {p, row, column, std::errc::invalid_argument};
+                }
+            }
+            else if (p == last || *p != options.delimiter)
+            {
+                // A row that ends early is missing the next column, anything else belongs to this one
+                return {p, row, is_row_end(p, last) ? column + 1 : column, std::errc::invalid_argument};
+            }
+            else
+            {
+                ++p;
+            }
+        }
+
+        p = skip_row_end(p, last);
+        ++row;
+    }
+
+    return {last, row, 0, std::errc()};
+}
+
+namespace {
+
+using boost::charconv::column_type;
+using boost::charconv::csv_write_options;
+
+// The most characters to_chars writes for a value of the column
+template <typename T>
+std::size_t max_float_chars(const csv_write_options& options) noexcept
+{
+    std::size_t n = static_cast<std::size_t>(boost::charconv::limits<T>::max_chars);
+
+    if (options.precision > 0)
+    {
+        n += static_cast<std::size_t>(options.precision);
+    }
+
+    // Fixed notation writes all of the zeros of large and of small values
+    if (options.fmt == chars_format::fixed)
+    {
+        n += static_cast<std::size_t>(std::numeric_limits<T>::max_exponent10 - std::numeric_limits<T>::min_exponent10);
+    }
+
+    return n;
+}
+
+std::size_t max_field_chars(column_type type, const csv_write_options& options) noexcept
+{
+    switch (type)
+    {
+        case column_type::int64:
+        case column_type::uint64:
+            return 20;
+        case column_type::float32:
+            return max_float_chars<float>(options);
+        case column_type::float64:
+            return max_float_chars<double>(options);
+        default:
+            return 0;
+    }
+}
+
+// The float kernel is called directly so that it is inlined into the loop over the fields
+template <typename T>
+inline boost::charconv::to_chars_result format_float(char* first, char* last, T value, chars_format fmt, int precision) noexcept
+{
+    return boost::charconv::detail::to_chars_float_impl(first, last, value, fmt, precision);
+}
+
+// Replaces the delimiter after the last field with the line break
+inline char* end_row(char* p, const csv_write_options& options) noexcept
+{
+    if (options.crlf)
+    {
+        p[-1] = '\r';
+        *p++ = '\n';
+    }
+    else
+    {
+        p[-1] = '\n';
+    }
+
+    return p;
+}
+
+inline bool needs_quotes(const char* name, std::size_t length, const csv_write_options& options) noexcept
+{
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        const char c = name[i];
+
+        if (c == options.delimiter || c == options.quote || c == '\n' || c == '\r')
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::errc write_all(int fd, const char* data, std::size_t size) noexcept
+{
+    while (size != 0)
+    {
+        #ifdef _WIN32
+        const unsigned chunk = size > (1U << 30) ? (1U << 30) : static_cast<unsigned>(size);
+        const auto n = ::_write(fd, data, chunk);
+        #else
+        const auto n = ::write(fd, data, size);
+        #endif
+
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return static_cast<std::errc>(errno);
+        }
+
+        if (n == 0)
+        {
+            return std::errc::io_error;
+        }
+
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+
+    return std::errc();
+}
+
+} // Namespace
+
+std::errc boost::charconv::csv_writer::reserve(std::size_t n) noexcept
+{
+    if (capacity_ - size_ >= n)
+    {
+        return std::errc();
+    }
+
+    // With a file descriptor the buffer is written out first, and only grows for a row larger than a block
+    if (fd_ >= 0 && size_ != 0)
+    {
+        const std::errc ec = flush();
+
+        if (ec != std::errc() || capacity_ - size_ >= n)
+        {
+            return ec;
+        }
+    }
+
+    std::size_t capacity = capacity_ == 0 ? block_size_ : fd_ >= 0 ? capacity_ : capacity_ * 2;
+
+    if (capacity - size_ < n)
+    {
+        capacity = size_ + n;
+    }
+
+    char* data = new (std::nothrow) char[capacity];
+
+    if (data == nullptr)
+    {
+        return std::errc::not_enough_memory;
+    }
+
+    if (size_ != 0)
+    {
+        std::memcpy(data, data_, size_);
+    }
+
+    delete[] data_;
+    data_ = data;
+    capacity_ = capacity;
+
+    return std::errc();
+}
+
+boost::charconv::csv_writer::~csv_writer()
+{
+    flush();
+    delete[] data_;
+}
+
+std::errc boost::charconv::csv_writer::flush() noexcept
+{
+    if (ec_ == std::errc() && fd_ >= 0 && size_ != 0)
+    {
+        ec_ = write_all(fd_, data_, size_);
+
+        if (ec_ == std::errc())
+        {
+            size_ = 0;
+        }
+    }
+
+    return ec_;
+}
+
+std::errc boost::charconv::csv_writer::write_header(const char* const* names, std::size_t count, const csv_write_options& options) noexcept
+{
+    if (ec_ != std::errc())
+    {
+        return ec_;
+    }
+
+    if (count == 0)
+    {
+        return std::errc::invalid_argument;
+    }
+
+    // Every character doubled, the quotes, and the delimiter or line break
+    std::size_t bound = options.crlf ? 1 : 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        bound += 2 * std::strlen(names[i]) + 3;
+    }
+
+    const std::errc ec = reserve(bound);
+
+    if (ec != std::errc())
+    {
+        return ec;
+    }
+
+    char* p = data_ + size_;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t length = std::strlen(names[i]);
+
+        if (needs_quotes(names[i], length, options))
+        {
+            *p++ = options.quote;
+
+            for (std::size_t j = 0; j < length; ++j)
+            {
+                if (names[i][j] == options.quote)
+                {
+                    *p++ = options.quote;
+                }
+
+                *p++ = names[i][j];
+            }
+
+            *p++ = options.quote;
+        }
+        else
+        {
+            std::memcpy(p, names[i], length);
+            p += length;
+        }
+
+        *p++ = options.delimiter;
+    }
+
+    size_ = static_cast<std::size_t>(end_row(p, options) - data_);
+
+    return std::errc();
+}
+
+std::errc boost::charconv::csv_writer::write_rows(const const_csv_column* columns, std::size_t column_count, std::size_t rows,
+                                                  const csv_write_options& options) noexcept
+{
+    if (ec_ != std::errc())
+    {
+        return ec_;
+    }
+
+    if (column_count == 0)
+    {
+        return std::errc::invalid_argument;
+    }
+
+    // The space for a whole row is reserved at once, so the fields and delimiters
+    // are written without checking the space left after each of them
+    std::size_t row_bound = column_count + (options.crlf ? 1 : 0);
+
+    for (std::size_t column = 0; column < column_count; ++column)
+    {
+        row_bound += max_field_chars(columns[column].type, options);
+    }
+
+    const int precision = options.precision < 0 ? -1 : options.precision;
+
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        const std::errc ec = reserve(row_bound);
+
+        if (ec != std::errc())
+        {
+            return ec;
+        }
+
+        char* p = data_ + size_;
+        char* const last = data_ + capacity_;
+
+        for (std::size_t column = 0; column < column_count; ++column)
+        {
+            const void* values = columns[column].values;
+            boost::charconv::to_chars_result r {p, std::errc()};
+
+            switch (columns[column].type)
+            {
+                case column_type::int64:
+                    r = boost::charconv::to_chars(p, last, static_cast<const std::int64_t*>(values)[row]);
+                    break;
+                case column_type::uint64:
+                    r = boost::charconv::to_chars(p, last, static_cast<const std::uint64_t*>(values)[row]);
+                    break;
+                case column_type::float32:
+                    r = format_float(p, last, static_cast<const float*>(values)[row], options.fmt, precision);
+                    break;
+                case column_type::float64:
+                    r = format_float(p, last, static_cast<const double*>(values)[row], options.fmt, precision);
+                    break;
+                default:
+                    break;
+            }
+
+            // The bound of the row rules out value_too_large, but not e.g. inf with chars_format::json
+            if (!r)
+            {
+                return r.ec;
+            }
+
+            p = r.ptr;
+            *p++ = options.delimiter;
+        }
+
+        size_ = static_cast<std::size_t>(end_row(p, options) - data_);
+    }
+
+    return std::errc();
+}
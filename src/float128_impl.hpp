@@ -164,6 +164,10 @@ inline __float128 compute_float128(std::int64_t q, Unsigned_Integer w, bool nega
 template <>
 inline to_chars_result to_chars_printf_impl<__float128>(char* first, char* last, __float128 value, chars_format fmt, int precision)
 {
+    BOOST_CHARCONV_STATS_TIER(printf);
+    BOOST_CHARCONV_PROBE4(to_chars_printf, &value, sizeof(__float128), static_cast<int>(fmt), precision);
+    BOOST_CHARCONV_CAPTURE_VALUE("printf", __float128, value, fmt, precision);
+
     // v % + . + num_digits(INT_MAX) + specifier + null terminator
     // 1 + 1 + 10 + 1 + 1
     char format[14] {};
@@ -207,6 +211,7 @@ inline to_chars_result to_chars_printf_impl<__float128>(char* first, char* last,
     switch (fmt)
     {
         case boost::charconv::chars_format::general:
+        case boost::charconv::chars_format::json:
             format[pos] = 'g';
             break;
 
@@ -230,6 +235,12 @@ inline to_chars_result to_chars_printf_impl<__float128>(char* first, char* last,
         return {last, static_cast<std::errc>(errno)};
     }
 
+    // The output was truncated to fit with the null terminator
+    if (rv >= last - first)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
     return {first + rv, std::errc()};
 }
 
@@ -278,6 +289,10 @@ inline from_chars_result from_chars_strtod_impl<__float128>(const char* first, c
 template <>
 inline from_chars_result from_chars_strtod<__float128>(const char* first, const char* last, __float128& value) noexcept
 {
+    BOOST_CHARCONV_STATS_COUNT(strtod);
+    BOOST_CHARCONV_PROBE2(from_chars_strtod, first, static_cast<std::size_t>(last - first));
+    BOOST_CHARCONV_CAPTURE_INPUT("strtod", __float128, first, static_cast<std::size_t>(last - first));
+
     if (last - first < 1024)
     {
         char buffer[1024];
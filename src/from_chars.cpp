@@ -15,7 +15,13 @@
 #include "from_chars_float_impl.hpp"
 #include <boost/charconv/detail/fast_float/fast_float.hpp>
 #include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/scan_number.hpp>
+#include <boost/charconv/stream_parser.hpp>
+#include <boost/charconv/to_chars.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/probes.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <new>
 #include <system_error>
 #include <string>
 #include <cstdlib>
@@ -32,6 +38,39 @@
 # pragma GCC diagnostic ignored "-Wmissing-field-initializers"
 #endif
 
+#if defined(BOOST_CHARCONV_HAS_QUADMATH) || !(BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC))
+
+namespace {
+
+// The 80 and 128-bit parsers only know the grammar of chars_format::general, so JSON is matched by
+// fast_float first and the number it accepted is then converted as general
+template <typename T>
+boost::charconv::from_chars_result from_chars_json(const char* first, const char* last, T& value) noexcept
+{
+    using namespace boost::charconv::detail::fast_float;
+
+    if (first >= last)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const auto pns = parse_number_string(first, last, parse_options{boost::charconv::chars_format::json});
+    if (!pns.valid)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    auto r = boost::charconv::from_chars_erange(first, pns.lastmatch, value, boost::charconv::chars_format::general);
+
+    // The general parser stops at the exponent of a zero, e.g. "0e5"
+    r.ptr = pns.lastmatch;
+    return r;
+}
+
+}
+
+#endif
+
 boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
 {
     if (fmt != boost::charconv::chars_format::hex)
@@ -53,6 +92,11 @@ boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char
 #ifdef BOOST_CHARCONV_HAS_QUADMATH
 boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, __float128& value, boost::charconv::chars_format fmt) noexcept
 {
+    if (boost::charconv::detail::fast_float::is_json_format(fmt))
+    {
+        return from_chars_json(first, last, value);
+    }
+
     bool sign {};
     std::int64_t exponent {};
 
@@ -127,6 +171,7 @@ boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char
     else if (r.ec == std::errc::not_supported)
     {
         // Fallback routine
+        BOOST_CHARCONV_PROBE2(compute_float128_fallback, first, static_cast<std::size_t>(last - first));
         r = boost::charconv::detail::from_chars_strtod(first, last, value);
     }
 
@@ -235,6 +280,11 @@ boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char
 {
     static_assert(std::numeric_limits<long double>::is_iec559, "Long double must be IEEE 754 compliant");
 
+    if (boost::charconv::detail::fast_float::is_json_format(fmt))
+    {
+        return from_chars_json(first, last, value);
+    }
+
     bool sign {};
     std::int64_t exponent {};
 
@@ -289,6 +339,7 @@ boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char
     else if (r.ec == std::errc::not_supported)
     {
         // Fallback routine
+        BOOST_CHARCONV_PROBE2(compute_float80_fallback, first, static_cast<std::size_t>(last - first));
         r = boost::charconv::detail::from_chars_strtod(first, last, value);
     }
 
@@ -499,3 +550,1026 @@ boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::stri
     return from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
 }
 #endif
+
+// Wide character overloads
+
+namespace {
+
+// Characters that can be part of a number, of inf, or of nan(n-char-sequence)
+template <typename UC>
+constexpr bool is_number_char(UC c) noexcept
+{
+    return (c >= UC('0') && c <= UC('9')) || (c >= UC('a') && c <= UC('z')) || (c >= UC('A') && c <= UC('Z')) ||
+           c == UC('.') || c == UC('+') || c == UC('-') || c == UC('(') || c == UC(')') || c == UC('_');
+}
+
+// Hex, and the parsers of long double wider than double, only read char. A number is a prefix of the run
+// of characters that can be part of one, so that run is narrowed into a buffer and parsed instead. The
+// char parsers also look at the character after a number, so the unit that ends the run is narrowed as
+// well, where any unit outside of ASCII becomes DEL, which is not part of a number either.
+template <typename T, typename UC>
+boost::charconv::from_chars_result_t<UC> from_chars_narrowed(const UC* first, const UC* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    const UC* end = first;
+    while (end < last && is_number_char(*end))
+    {
+        ++end;
+    }
+
+    if (end < last)
+    {
+        ++end;
+    }
+
+    const auto n = static_cast<std::size_t>(end - first);
+
+    char buffer[256];
+    std::string storage;
+    char* narrow = buffer;
+
+    if (n > sizeof(buffer))
+    {
+        BOOST_TRY
+        {
+            storage.resize(n);
+        }
+        BOOST_CATCH (const std::bad_alloc&)
+        {
+            return {first, std::errc::not_enough_memory};
+        }
+        BOOST_CATCH_END
+
+        narrow = &storage[0];
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        narrow[i] = static_cast<std::uint32_t>(first[i]) > 127U ? '\x7F' : static_cast<char>(first[i]);
+    }
+
+    const auto r = boost::charconv::from_chars(narrow, narrow + n, value, fmt);
+    return {first + (r.ptr - narrow), r.ec};
+}
+
+// fast_float reads every code unit type directly, 8 digits at a time
+template <typename T, typename UC>
+boost::charconv::from_chars_result_t<UC> from_chars_wide_impl(const UC* first, const UC* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt == boost::charconv::chars_format::hex)
+    {
+        return from_chars_narrowed(first, last, value, fmt);
+    }
+
+    T temp_value {};
+    const auto r = boost::charconv::detail::fast_float::from_chars(first, last, temp_value, fmt);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+template <typename UC>
+boost::charconv::from_chars_result_t<UC> from_chars_wide_impl(const UC* first, const UC* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    #if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
+
+    double d {};
+    const auto r = from_chars_wide_impl(first, last, d, fmt);
+
+    if (r)
+    {
+        value = d;
+    }
+
+    return r;
+
+    #else
+
+    return from_chars_narrowed(first, last, value, fmt);
+
+    #endif
+}
+
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char16_t> boost::charconv::from_chars(const char16_t* first, const char16_t* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<char32_t> boost::charconv::from_chars(const char32_t* first, const char32_t* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result_t<wchar_t> boost::charconv::from_chars(const wchar_t* first, const wchar_t* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_wide_impl(first, last, value, fmt);
+}
+
+// Padded buffer overloads
+
+namespace {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_padded_impl(const char* first, const char* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt == boost::charconv::chars_format::hex)
+    {
+        return from_chars_strict_impl(first, last, value, fmt);
+    }
+
+    T temp_value {};
+    const auto r = boost::charconv::detail::fast_float::from_chars_padded(first, last, temp_value, fmt);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_padded_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_padded_impl(first, last, value, fmt);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
+
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    double d;
+    const auto r = from_chars_padded_impl(first, last, d, fmt);
+    if (r)
+    {
+        value = static_cast<long double>(d);
+    }
+
+    return r;
+}
+
+#else
+
+// The 80 and 128-bit parsers have no padded fast path, so the bounds checked parser is used
+boost::charconv::from_chars_result boost::charconv::from_chars_padded(const char* first, const char* last, long double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_strict_impl(first, last, value, fmt);
+}
+
+#endif
+
+// Scanning without conversion
+
+namespace {
+
+boost::charconv::scan_result scan_number_impl(const char* first, const char* last, boost::charconv::chars_format fmt,
+                                              boost::charconv::detail::fast_float::parsed_number_string& pns) noexcept
+{
+    using namespace boost::charconv::detail::fast_float;
+    using boost::charconv::number_kind;
+
+    boost::charconv::scan_result r {first, std::errc::invalid_argument, number_kind::integer, false, 0, 0};
+
+    if (fmt == boost::charconv::chars_format::hex)
+    {
+        r.ec = std::errc::not_supported;
+        return r;
+    }
+
+    if (first >= last)
+    {
+        return r;
+    }
+
+    r.negative = *first == '-';
+
+    pns = parse_number_string(first, last, parse_options{fmt});
+    if (!pns.valid)
+    {
+        if (boost::charconv::detail::fast_float::is_json_format(fmt))
+        {
+            return r;
+        }
+
+        // Only validate the spelling of the non-finite values, the value itself is discarded
+        double discard;
+        const auto infnan = boost::charconv::detail::fast_float::detail::parse_infnan(first, last, discard);
+        if (infnan.ec == std::errc())
+        {
+            r.ptr = infnan.ptr;
+            r.ec = std::errc();
+            const char c = first[static_cast<int>(r.negative)];
+            r.kind = (c == 'n' || c == 'N') ? number_kind::nan : number_kind::infinity;
+        }
+
+        return r;
+    }
+
+    r.ptr = pns.lastmatch;
+    r.ec = std::errc();
+
+    // Anything past the integer digits is either a fraction or an exponent
+    const char* end_of_integer = pns.integer.ptr + pns.integer.len();
+    r.kind = (pns.lastmatch != end_of_integer) ? number_kind::floating : number_kind::integer;
+
+    std::size_t leading_zeros = 0;
+    while (leading_zeros < pns.integer.len() && pns.integer[leading_zeros] == '0')
+    {
+        ++leading_zeros;
+    }
+    if (leading_zeros == pns.integer.len())
+    {
+        std::size_t i = 0;
+        while (i < pns.fraction.len() && pns.fraction[i] == '0')
+        {
+            ++i;
+        }
+        leading_zeros += i;
+    }
+
+    r.digits = pns.integer.len() + pns.fraction.len() - leading_zeros;
+    r.exponent = r.digits == 0 ? 0 : static_cast<std::int64_t>(scientific_exponent(pns));
+
+    return r;
+}
+
+// Rebuilds the state of parse_number_string so that the conversion can resume without scanning the digits again
+boost::charconv::detail::fast_float::parsed_number_string to_parsed_number_string(const boost::charconv::decimal_token& token) noexcept
+{
+    using namespace boost::charconv::detail::fast_float;
+
+    const char* integer_first = token.first + static_cast<int>(token.negative);
+
+    parsed_number_string pns;
+    pns.exponent = token.exponent;
+    pns.mantissa = token.mantissa;
+    pns.lastmatch = token.first + token.length;
+    pns.negative = token.negative;
+    pns.valid = true;
+    pns.too_many_digits = token.truncated;
+    pns.integer = span<const char>(integer_first, token.integer_length);
+    pns.fraction = span<const char>(integer_first + token.integer_length + 1, token.fraction_length);
+
+    return pns;
+}
+
+template <typename T>
+boost::charconv::from_chars_result decimal_token_to_impl(const boost::charconv::decimal_token& token, T& value) noexcept
+{
+    using boost::charconv::number_kind;
+
+    T temp_value {};
+    boost::charconv::from_chars_result r;
+
+    if (token.kind == number_kind::infinity || token.kind == number_kind::nan)
+    {
+        r = boost::charconv::detail::fast_float::detail::parse_infnan(token.first, token.first + token.length, temp_value);
+    }
+    else
+    {
+        auto pns = to_parsed_number_string(token);
+        r = boost::charconv::detail::fast_float::from_chars_advanced(pns, temp_value);
+    }
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+} // Namespace anonymous
+
+boost::charconv::scan_result boost::charconv::scan_number(const char* first, const char* last, boost::charconv::chars_format fmt) noexcept
+{
+    boost::charconv::detail::fast_float::parsed_number_string pns;
+    return scan_number_impl(first, last, fmt, pns);
+}
+
+boost::charconv::scan_result boost::charconv::scan_number(boost::core::string_view sv, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::scan_number(sv.data(), sv.data() + sv.size(), fmt);
+}
+
+boost::charconv::scan_result boost::charconv::scan_number(const char* first, const char* last, boost::charconv::decimal_token& token, boost::charconv::chars_format fmt) noexcept
+{
+    boost::charconv::detail::fast_float::parsed_number_string pns;
+    const auto r = scan_number_impl(first, last, fmt, pns);
+
+    if (r)
+    {
+        token.first = first;
+        token.length = static_cast<std::size_t>(r.ptr - first);
+        token.mantissa = pns.mantissa;
+        token.exponent = pns.exponent;
+        token.integer_length = pns.integer.len();
+        token.fraction_length = pns.fraction.len();
+        token.kind = r.kind;
+        token.negative = r.negative;
+        token.truncated = pns.too_many_digits;
+    }
+
+    return r;
+}
+
+boost::charconv::scan_result boost::charconv::scan_number(boost::core::string_view sv, boost::charconv::decimal_token& token, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::scan_number(sv.data(), sv.data() + sv.size(), token, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::detail::decimal_token_to(const boost::charconv::decimal_token& token, float& value) noexcept
+{
+    return decimal_token_to_impl(token, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::detail::decimal_token_to(const boost::charconv::decimal_token& token, double& value) noexcept
+{
+    return decimal_token_to_impl(token, value);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
+
+boost::charconv::from_chars_result boost::charconv::detail::decimal_token_to(const boost::charconv::decimal_token& token, long double& value) noexcept
+{
+    double d;
+    const auto r = decimal_token_to_impl(token, d);
+    if (r)
+    {
+        value = static_cast<long double>(d);
+    }
+
+    return r;
+}
+
+#else
+
+// The 80 and 128-bit parsers do not share the fast_float state, so the token is parsed again.
+// The token only holds values accepted by chars_format::general
+boost::charconv::from_chars_result boost::charconv::detail::decimal_token_to(const boost::charconv::decimal_token& token, long double& value) noexcept
+{
+    return boost::charconv::from_chars(token.first, token.first + token.length, value);
+}
+
+#endif
+
+// Resumable parsing
+
+namespace {
+
+using boost::charconv::detail::float_stream_state;
+
+enum : unsigned
+{
+    stream_start,
+    stream_sign,
+    stream_integer,
+    stream_point,       // The decimal point of chars_format::json, which needs a digit after it
+    stream_fraction,
+    stream_exp_mark,    // e or E, only part of the number if a digit follows
+    stream_exp_sign,    // e+ or e-, likewise
+    stream_exponent,
+    stream_word,        // inf, infinity, or nan
+    stream_payload      // nan( waiting for the ) that ends the n-char-sequence
+};
+
+enum : unsigned
+{
+    stream_finite,
+    stream_infinity,
+    stream_nan,
+    stream_signaling_nan    // nan(s...)
+};
+
+enum class stream_outcome
+{
+    more,
+    done,
+    invalid
+};
+
+constexpr bool stream_has(boost::charconv::chars_format fmt, boost::charconv::chars_format flag) noexcept
+{
+    return (static_cast<unsigned>(fmt) & static_cast<unsigned>(flag)) != 0;
+}
+
+constexpr bool stream_is_json(boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::fast_float::is_json_format(fmt);
+}
+
+constexpr bool stream_is_digit(char c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool stream_is_payload(char c) noexcept
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || stream_is_digit(c) || c == '_';
+}
+
+void stream_digit(float_stream_state& s, char c, bool integer_part) noexcept
+{
+    s.saw_digit = true;
+
+    if (s.significant == 0 && c == '0')
+    {
+        if (!integer_part)
+        {
+            --s.decimal_point;
+        }
+
+        return;
+    }
+
+    if (s.significant < float_stream_state::max_digits)
+    {
+        s.digits[s.significant] = c;
+    }
+    else if (c != '0')
+    {
+        s.sticky = true;
+    }
+
+    ++s.significant;
+
+    if (integer_part)
+    {
+        ++s.decimal_point;
+    }
+}
+
+void stream_hold(float_stream_state& s, const char* first, const char* last) noexcept
+{
+    for (; first != last; ++first)
+    {
+        if (s.held_length == float_stream_state::max_held)
+        {
+            s.held_overflow = true;
+            return;
+        }
+
+        s.held[s.held_length++] = *first;
+    }
+}
+
+// The character at p can not continue the number, or p is null at the end of the input.
+// end is set to one past the number, or to null if the number ended in an earlier chunk.
+stream_outcome stream_terminate(const float_stream_state& s, const char* p, const char* tentative, const char*& end) noexcept
+{
+    using boost::charconv::chars_format;
+
+    switch (s.phase)
+    {
+        case stream_integer:
+        case stream_fraction:
+            // chars_format::scientific alone requires an exponent
+            if (!s.saw_digit || !stream_has(s.fmt, chars_format::fixed))
+            {
+                return stream_outcome::invalid;
+            }
+            end = p;
+            return stream_outcome::done;
+
+        case stream_exp_mark:
+        case stream_exp_sign:
+            // JSON requires the digits of an exponent that has been started
+            if (!stream_has(s.fmt, chars_format::fixed) || stream_is_json(s.fmt))
+            {
+                return stream_outcome::invalid;
+            }
+            end = tentative;
+            return stream_outcome::done;
+
+        case stream_exponent:
+            end = p;
+            return stream_outcome::done;
+
+        case stream_word:
+            if (s.word < 3)
+            {
+                return stream_outcome::invalid;
+            }
+            end = s.word == 3 ? p : tentative;
+            return stream_outcome::done;
+
+        case stream_payload:
+            end = tentative;
+            return stream_outcome::done;
+
+        default:
+            return stream_outcome::invalid;
+    }
+}
+
+stream_outcome stream_scan(float_stream_state& s, const char* first, const char* last, const char*& end) noexcept
+{
+    using boost::charconv::chars_format;
+
+    // First character of this chunk that may not belong to the number
+    const char* tentative = nullptr;
+    const bool json = stream_is_json(s.fmt);
+
+    for (const char* p = first; p != last; ++p)
+    {
+        const char c = *p;
+
+        switch (s.phase)
+        {
+            case stream_start:
+                if (c == '-')
+                {
+                    s.negative = true;
+                    s.phase = stream_sign;
+                    continue;
+                }
+                BOOST_FALLTHROUGH;
+
+            case stream_sign:
+                if (stream_is_digit(c))
+                {
+                    s.phase = stream_integer;
+                    stream_digit(s, c, true);
+                    continue;
+                }
+                // JSON numbers start with a digit, which rules out .5, inf, and nan
+                if (json)
+                {
+                    return stream_outcome::invalid;
+                }
+                if (c == '.')
+                {
+                    s.phase = stream_fraction;
+                    continue;
+                }
+                if (c == 'i' || c == 'I' || c == 'n' || c == 'N')
+                {
+                    s.kind = (c == 'i' || c == 'I') ? stream_infinity : stream_nan;
+                    s.phase = stream_word;
+                    s.word = 1;
+                    continue;
+                }
+                return stream_outcome::invalid;
+
+            case stream_integer:
+                if (stream_is_digit(c))
+                {
+                    // Only zeros so far, which JSON allows as a single 0
+                    if (json && s.significant == 0)
+                    {
+                        return stream_outcome::invalid;
+                    }
+                    stream_digit(s, c, true);
+                    continue;
+                }
+                if (c == '.')
+                {
+                    s.phase = json ? stream_point : stream_fraction;
+                    continue;
+                }
+                BOOST_FALLTHROUGH;
+
+            case stream_fraction:
+                if (stream_is_digit(c))
+                {
+                    stream_digit(s, c, false);
+                    continue;
+                }
+                if ((c == 'e' || c == 'E') && s.saw_digit && stream_has(s.fmt, chars_format::scientific))
+                {
+                    tentative = p;
+                    s.phase = stream_exp_mark;
+                    continue;
+                }
+                break;
+
+            case stream_point:
+                if (stream_is_digit(c))
+                {
+                    s.phase = stream_fraction;
+                    stream_digit(s, c, false);
+                    continue;
+                }
+                return stream_outcome::invalid;
+
+            case stream_exp_mark:
+                if (c == '-' || c == '+')
+                {
+                    s.exp_negative = c == '-';
+                    s.phase = stream_exp_sign;
+                    continue;
+                }
+                BOOST_FALLTHROUGH;
+
+            case stream_exp_sign:
+                if (stream_is_digit(c))
+                {
+                    tentative = nullptr;
+                    s.held_length = 0;
+                    s.phase = stream_exponent;
+                    s.exp_number = c - '0';
+                    continue;
+                }
+                break;
+
+            case stream_exponent:
+                if (stream_is_digit(c))
+                {
+                    // Same saturation as parse_number_string
+                    if (s.exp_number < 0x10000000)
+                    {
+                        s.exp_number = 10 * s.exp_number + (c - '0');
+                    }
+                    continue;
+                }
+                break;
+
+            case stream_word:
+            {
+                const char* word = s.kind == stream_nan ? "nan" : "infinity";
+
+                if (word[s.word] != '\0' && static_cast<char>(c | 0x20) == word[s.word])
+                {
+                    if (s.word == 3)
+                    {
+                        tentative = p;
+                    }
+
+                    if (++s.word == 8)
+                    {
+                        s.held_length = 0;
+                        end = p + 1;
+                        return stream_outcome::done;
+                    }
+
+                    continue;
+                }
+
+                if (s.kind == stream_nan && s.word == 3 && c == '(')
+                {
+                    tentative = p;
+                    s.phase = stream_payload;
+                    continue;
+                }
+                break;
+            }
+
+            case stream_payload:
+                // The first character of the n-char-sequence, counted on from the 3 letters of nan
+                if (s.word == 3)
+                {
+                    s.word = 4;
+                    if (c == 's' || c == 'S')
+                    {
+                        s.kind = stream_signaling_nan;
+                    }
+                }
+                if (c == ')')
+                {
+                    s.held_length = 0;
+                    end = p + 1;
+                    return stream_outcome::done;
+                }
+                if (stream_is_payload(c))
+                {
+                    continue;
+                }
+                break;
+
+            default:
+                BOOST_UNREACHABLE_RETURN(stream_outcome::invalid);
+        }
+
+        return stream_terminate(s, p, tentative, end);
+    }
+
+    if (s.phase == stream_exp_mark || s.phase == stream_exp_sign || s.phase == stream_payload || (s.phase == stream_word && s.word > 3))
+    {
+        stream_hold(s, tentative != nullptr ? tentative : first, last);
+    }
+
+    return stream_outcome::more;
+}
+
+// Resumes the conversion from the stored digits as parse_number_string would have left it
+template <typename T>
+std::errc stream_to_float(float_stream_state& s, T& value) noexcept
+{
+    using namespace boost::charconv::detail::fast_float;
+
+    const auto stored = static_cast<std::size_t>(s.significant < float_stream_state::max_digits ? s.significant : float_stream_state::max_digits);
+    std::size_t length = stored;
+
+    if (s.sticky)
+    {
+        s.digits[length++] = '1';
+    }
+
+    const std::size_t leading = stored < 19 ? stored : 19;
+    std::uint64_t mantissa = 0;
+    for (std::size_t i = 0; i < leading; ++i)
+    {
+        mantissa = mantissa * 10 + static_cast<std::uint64_t>(s.digits[i] - '0');
+    }
+
+    parsed_number_string pns;
+    pns.mantissa = mantissa;
+    pns.exponent = s.decimal_point - static_cast<std::int64_t>(leading) + (s.exp_negative ? -s.exp_number : s.exp_number);
+    pns.negative = s.negative;
+    pns.valid = true;
+    pns.too_many_digits = s.significant > 19;
+    pns.integer = span<const char>(s.digits, length);
+    pns.lastmatch = s.digits + length;
+
+    if (s.significant == 0)
+    {
+        pns.exponent = 0;
+    }
+
+    return from_chars_advanced(pns, value).ec;
+}
+
+template <typename T>
+void stream_quiet_nan(const float_stream_state& s, T& value) noexcept
+{
+    value = s.negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+}
+
+// fast_float makes every nan(n-char-sequence) a quiet NaN
+void stream_nan_value(const float_stream_state& s, float& value) noexcept
+{
+    stream_quiet_nan(s, value);
+}
+
+void stream_nan_value(const float_stream_state& s, double& value) noexcept
+{
+    stream_quiet_nan(s, value);
+}
+
+std::errc stream_to_value(float_stream_state& s, float& value) noexcept
+{
+    return stream_to_float(s, value);
+}
+
+std::errc stream_to_value(float_stream_state& s, double& value) noexcept
+{
+    return stream_to_float(s, value);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 64 || defined(BOOST_MSVC)
+
+void stream_nan_value(const float_stream_state& s, long double& value) noexcept
+{
+    stream_quiet_nan(s, value);
+}
+
+std::errc stream_to_value(float_stream_state& s, long double& value) noexcept
+{
+    double d;
+    const auto ec = stream_to_float(s, d);
+    value = static_cast<long double>(d);
+    return ec;
+}
+
+#else
+
+// Same as from_chars, which makes nan(s...) a signaling NaN
+void stream_nan_value(const float_stream_state& s, long double& value) noexcept
+{
+    if (s.kind == stream_signaling_nan)
+    {
+        value = s.negative ? -std::numeric_limits<long double>::signaling_NaN() : std::numeric_limits<long double>::signaling_NaN();
+    }
+    else
+    {
+        stream_quiet_nan(s, value);
+    }
+}
+
+// The 80 and 128-bit parsers do not share the fast_float state, so the digits are parsed again.
+// Beyond max_digits only a non-zero digit is kept, which is exact for double but not in every case for long double.
+std::errc stream_to_value(float_stream_state& s, long double& value) noexcept
+{
+    const auto stored = static_cast<std::size_t>(s.significant < float_stream_state::max_digits ? s.significant : float_stream_state::max_digits);
+    std::size_t length = stored;
+
+    if (s.sticky)
+    {
+        s.digits[length++] = '1';
+    }
+
+    if (s.significant == 0)
+    {
+        s.digits[length++] = '0';
+    }
+
+    char buffer[float_stream_state::max_digits + 32];
+    char* p = buffer;
+    if (s.negative)
+    {
+        *p++ = '-';
+    }
+
+    std::memcpy(p, s.digits, length);
+    p += length;
+    *p++ = 'e';
+
+    const std::int64_t exponent = s.decimal_point - static_cast<std::int64_t>(length) + (s.exp_negative ? -s.exp_number : s.exp_number);
+    p = boost::charconv::to_chars(p, buffer + sizeof(buffer), exponent).ptr;
+
+    return boost::charconv::from_chars(buffer, p, value).ec;
+}
+
+#endif
+
+template <typename T>
+boost::charconv::from_chars_result stream_complete(float_stream_state& s, const char* first, const char* end, T& value) noexcept
+{
+    boost::charconv::from_chars_result r {end, std::errc()};
+
+    if (end == nullptr)
+    {
+        // Ended in an earlier chunk, the held characters are left over
+        r.ptr = first;
+
+        if (s.held_overflow)
+        {
+            s.clear();
+            s.held_length = 0;
+            s.held_overflow = false;
+            return {first, std::errc::invalid_argument};
+        }
+    }
+    else
+    {
+        s.held_length = 0;
+    }
+
+    T temp_value {};
+
+    if (s.kind == stream_infinity)
+    {
+        temp_value = s.negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    }
+    else if (s.kind == stream_nan || s.kind == stream_signaling_nan)
+    {
+        stream_nan_value(s, temp_value);
+    }
+    else
+    {
+        r.ec = stream_to_value(s, temp_value);
+    }
+
+    if (r.ec == std::errc())
+    {
+        value = temp_value;
+    }
+
+    s.clear();
+    s.held_overflow = false;
+
+    return r;
+}
+
+template <typename T>
+boost::charconv::from_chars_result stream_feed_impl(float_stream_state& s, const char* first, const char* last, T& value) noexcept
+{
+    if (s.fmt == boost::charconv::chars_format::hex)
+    {
+        return {first, std::errc::not_supported};
+    }
+
+    const bool starts_here = s.phase == stream_start;
+    if (starts_here)
+    {
+        s.held_length = 0;
+        s.held_overflow = false;
+    }
+
+    const char* end = nullptr;
+    const auto outcome = stream_scan(s, first, last, end);
+
+    if (outcome == stream_outcome::more)
+    {
+        return {last, std::errc::resource_unavailable_try_again};
+    }
+
+    if (outcome == stream_outcome::done)
+    {
+        // A number that starts and ends inside the chunk is converted by from_chars in one go
+        if (starts_here)
+        {
+            s.clear();
+
+            T temp_value {};
+            const auto r = boost::charconv::from_chars(first, end, temp_value, s.fmt);
+            if (r)
+            {
+                value = temp_value;
+            }
+
+            return r;
+        }
+
+        return stream_complete(s, first, end, value);
+    }
+
+    s.clear();
+    s.held_length = 0;
+    s.held_overflow = false;
+    return {first, std::errc::invalid_argument};
+}
+
+template <typename T>
+boost::charconv::from_chars_result stream_finish_impl(float_stream_state& s, T& value) noexcept
+{
+    if (s.fmt == boost::charconv::chars_format::hex)
+    {
+        return {nullptr, std::errc::not_supported};
+    }
+
+    const char* end = nullptr;
+
+    if (stream_terminate(s, nullptr, nullptr, end) == stream_outcome::done)
+    {
+        return stream_complete(s, nullptr, end, value);
+    }
+
+    s.clear();
+    s.held_length = 0;
+    s.held_overflow = false;
+    return {nullptr, std::errc::invalid_argument};
+}
+
+} // Namespace anonymous
+
+boost::charconv::from_chars_result boost::charconv::detail::stream_feed(float_stream_state& state, const char* first, const char* last, float& value) noexcept
+{
+    return stream_feed_impl(state, first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::detail::stream_feed(float_stream_state& state, const char* first, const char* last, double& value) noexcept
+{
+    return stream_feed_impl(state, first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::detail::stream_feed(float_stream_state& state, const char* first, const char* last, long double& value) noexcept
+{
+    return stream_feed_impl(state, first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::detail::stream_finish(float_stream_state& state, float& value) noexcept
+{
+    return stream_finish_impl(state, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::detail::stream_finish(float_stream_state& state, double& value) noexcept
+{
+    return stream_finish_impl(state, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::detail::stream_finish(float_stream_state& state, long double& value) noexcept
+{
+    return stream_finish_impl(state, value);
+}
@@ -0,0 +1,301 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/load_numbers.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <new>
+#include <system_error>
+#include <vector>
+#include <cerrno>
+#include <cstdio>
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#  define BOOST_CHARCONV_LOAD_USE_MMAP
+#endif
+
+namespace {
+
+using boost::charconv::load_result;
+using boost::charconv::chars_format;
+
+template <typename T>
+struct vector_store
+{
+    std::vector<T>& out;
+
+    std::errc operator()(T value) noexcept
+    {
+        BOOST_TRY
+        {
+            out.push_back(value);
+        }
+        BOOST_CATCH (const std::bad_alloc&)
+        {
+            return std::errc::not_enough_memory;
+        }
+        BOOST_CATCH_END
+
+        return std::errc();
+    }
+};
+
+template <typename T>
+struct buffer_store
+{
+    T* next;
+    T* last;
+
+    std::errc operator()(T value) noexcept
+    {
+        if (next == last)
+        {
+            return std::errc::value_too_large;
+        }
+
+        *next++ = value;
+        return std::errc();
+    }
+};
+
+// With '\n' as the delimiter a line may end with "\r\n". Returns the end of the line ending at p, or p
+inline const char* skip_carriage_return(const char* p, const char* last, char delimiter) noexcept
+{
+    if (delimiter == '\n' && p != last && *p == '\r' && p + 1 != last && p[1] == '\n')
+    {
+        ++p;
+    }
+
+    return p;
+}
+
+// True if [first, last) is only empty records, such as the blank lines at the end of a file
+inline bool only_separators(const char* first, const char* last, char delimiter) noexcept
+{
+    while (first != last)
+    {
+        first = skip_carriage_return(first, last, delimiter);
+
+        if (*first != delimiter)
+        {
+            return false;
+        }
+
+        ++first;
+    }
+
+    return true;
+}
+
+// [first, last) must be followed by at least from_chars_padding readable bytes
+template <typename T, typename Store>
+load_result parse_padded(const char* first, const char* last, char delimiter, chars_format fmt, Store& store) noexcept
+{
+    const char* const begin = first;
+    std::size_t count = 0;
+
+    while (first != last && !only_separators(first, last, delimiter))
+    {
+        T value {};
+        auto r = boost::charconv::from_chars_padded(first, last, value, fmt);
+        std::errc ec = r.ec;
+
+        r.ptr = skip_carriage_return(r.ptr, last, delimiter);
+
+        if (ec == std::errc() && r.ptr != last && *r.ptr != delimiter)
+        {
+            ec = std::errc::invalid_argument;
+        }
+
+        if (ec == std::errc())
+        {
+            ec = store(value);
+        }
+
+        if (ec != std::errc())
+        {
+            return {count, static_cast<std::size_t>(first - begin), ec};
+        }
+
+        ++count;
+        first = r.ptr == last ? last : r.ptr + 1;
+    }
+
+    return {count, static_cast<std::size_t>(last - begin), std::errc()};
+}
+
+// Reads the whole file into memory, for pipes and for platforms without mmap
+template <typename T, typename Store>
+load_result read_file(const char* path, char delimiter, chars_format fmt, Store& store) noexcept
+{
+    std::FILE* file = std::fopen(path, "rb");
+
+    if (file == nullptr)
+    {
+        return {0, 0, static_cast<std::errc>(errno)};
+    }
+
+    std::vector<char> text;
+    std::errc ec {};
+
+    BOOST_TRY
+    {
+        char buffer[65536];
+        std::size_t read;
+
+        while ((read = std::fread(buffer, 1, sizeof(buffer), file)) != 0)
+        {
+            text.insert(text.end(), buffer, buffer + read);
+        }
+
+        if (std::ferror(file))
+        {
+            ec = std::errc::io_error;
+        }
+
+        text.resize(text.size() + boost::charconv::from_chars_padding);
+    }
+    BOOST_CATCH (const std::bad_alloc&)
+    {
+        ec = std::errc::not_enough_memory;
+    }
+    BOOST_CATCH_END
+
+    std::fclose(file);
+
+    if (ec != std::errc())
+    {
+        return {0, 0, ec};
+    }
+
+    return parse_padded<T>(text.data(), text.data() + text.size() - boost::charconv::from_chars_padding, delimiter, fmt, store);
+}
+
+template <typename T, typename Store>
+load_result load_file(const char* path, char delimiter, chars_format fmt, Store& store) noexcept
+{
+#ifdef BOOST_CHARCONV_LOAD_USE_MMAP
+
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1)
+    {
+        return {0, 0, static_cast<std::errc>(errno)};
+    }
+
+    struct stat st;
+
+    if (::fstat(fd, &st) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        return {0, 0, static_cast<std::errc>(error)};
+    }
+
+    if (!S_ISREG(st.st_mode))
+    {
+        ::close(fd);
+        return read_file<T>(path, delimiter, fmt, store);
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+
+    if (size == 0)
+    {
+        ::close(fd);
+        return {0, 0, std::errc()};
+    }
+
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const std::size_t pages = (size + page - 1) / page * page;
+    std::size_t length = pages;
+    void* base;
+
+    // The rest of the last page reads as zeros and is the padding of from_chars_padded
+    if (pages - size >= boost::charconv::from_chars_padding)
+    {
+        base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    else
+    {
+        // Too little of the last page is left, so the file is mapped over the start of
+        // an anonymous mapping one page longer, whose last page provides the padding
+        length = pages + page;
+        base = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (base != MAP_FAILED && ::mmap(base, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+        {
+            const int error = errno;
+            ::munmap(base, length);
+            base = MAP_FAILED;
+            errno = error;
+        }
+    }
+
+    const int error = errno;
+    ::close(fd);
+
+    if (base == MAP_FAILED)
+    {
+        return {0, 0, static_cast<std::errc>(error)};
+    }
+
+#ifdef MADV_SEQUENTIAL
+    ::madvise(base, size, MADV_SEQUENTIAL);
+#endif
+
+    const char* data = static_cast<const char*>(base);
+    const load_result r = parse_padded<T>(data, data + size, delimiter, fmt, store);
+
+    ::munmap(base, length);
+    return r;
+
+#else
+
+    return read_file<T>(path, delimiter, fmt, store);
+
+#endif
+}
+
+template <typename T>
+load_result load_numbers_impl(const char* path, char delimiter, std::vector<T>& out, chars_format fmt) noexcept
+{
+    vector_store<T> store {out};
+    return load_file<T>(path, delimiter, fmt, store);
+}
+
+template <typename T>
+load_result load_numbers_impl(const char* path, char delimiter, T* first, T* last, chars_format fmt) noexcept
+{
+    buffer_store<T> store {first, last};
+    return load_file<T>(path, delimiter, fmt, store);
+}
+
+} // Namespace
+
+boost::charconv::load_result boost::charconv::load_numbers(const char* path, char delimiter, std::vector<float>& out, chars_format fmt) noexcept
+{
+    return load_numbers_impl(path, delimiter, out, fmt);
+}
+
+boost::charconv::load_result boost::charconv::load_numbers(const char* path, char delimiter, std::vector<double>& out, chars_format fmt) noexcept
+{
+    return load_numbers_impl(path, delimiter, out, fmt);
+}
+
+boost::charconv::load_result boost::charconv::load_numbers(const char* path, char delimiter, float* first, float* last, chars_format fmt) noexcept
+{
+    return load_numbers_impl(path, delimiter, first, last, fmt);
+}
+
+boost::charconv::load_result boost::charconv::load_numbers(const char* path, char delimiter, double* first, double* last, chars_format fmt) noexcept
+{
+    return load_numbers_impl(path, delimiter, first, last, fmt);
+}
@@ -0,0 +1,646 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/parallel.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/limits.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+// Below this many bytes per chunk starting a thread costs more than it saves
+constexpr std::size_t min_chunk_size = 64 * 1024;
+
+// The same for the number of values formatted per slice
+constexpr std::size_t min_slice_size = 8 * 1024;
+
+// More chunks than threads, so that a thread that got the slow inputs can be helped out
+constexpr std::size_t chunks_per_thread = 8;
+
+// The tasks of one worker as a range [front, back) of task indices. Both ends are packed
+// into one word so that the owner and the thieves take tasks with a single compare and swap.
+// Padded to a cache line so that workers taking tasks do not slow each other down.
+struct task_queue
+{
+    std::atomic<std::uint64_t> bounds;
+    char padding[64 - sizeof(std::atomic<std::uint64_t>)];
+};
+
+constexpr std::uint64_t pack_bounds(std::uint32_t front, std::uint32_t back) noexcept
+{
+    return (static_cast<std::uint64_t>(front) << 32) | back;
+}
+
+// The owner takes tasks from the front of its queue and the thieves from the back
+bool take_task(task_queue& queue, bool steal, std::size_t& task) noexcept
+{
+    std::uint64_t bounds = queue.bounds.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        const auto front = static_cast<std::uint32_t>(bounds >> 32);
+        const auto back = static_cast<std::uint32_t>(bounds);
+
+        if (front == back)
+        {
+            return false;
+        }
+
+        const std::uint64_t next = steal ? pack_bounds(front, back - 1) : pack_bounds(front + 1, back);
+
+        // The tasks publish nothing through the queues, their results are read after the join
+        if (queue.bounds.compare_exchange_weak(bounds, next, std::memory_order_relaxed))
+        {
+            task = steal ? back - 1 : front;
+            return true;
+        }
+    }
+}
+
+unsigned resolve_threads(unsigned threads) noexcept
+{
+    if (threads == 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    return threads == 0 ? 1 : threads;
+}
+
+// Worker threads shared by all the calls. They are started by the first call that needs them,
+// and more are added when a call asks for more threads than there are, so a call only pays for
+// handing its jobs to threads that are already waiting.
+class thread_pool
+{
+public:
+    static thread_pool& instance()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    // Runs job(0) on the calling thread and job(i) for i in [1, threads) on the workers.
+    // A job that no worker has started by the time job(0) returns is not run, which is
+    // safe because the jobs of run_tasks only take the tasks that are left.
+    void run(unsigned threads, const std::function<void(unsigned)>& job) noexcept
+    {
+        batch b {&job, 0, {}};
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            BOOST_TRY
+            {
+                while (workers_.size() + 1 < threads)
+                {
+                    workers_.emplace_back(&thread_pool::work, this);
+                }
+            }
+            BOOST_CATCH (...)
+            {
+            }
+            BOOST_CATCH_END
+
+            const auto queued = (std::min)(threads - 1, static_cast<unsigned>(workers_.size()));
+
+            for (unsigned i = 1; i <= queued; ++i)
+            {
+                BOOST_TRY
+                {
+                    jobs_.push_back(entry {&b, i});
+                    ++b.pending;
+                }
+                BOOST_CATCH (const std::bad_alloc&)
+                {
+                    break;
+                }
+                BOOST_CATCH_END
+            }
+        }
+
+        wake_.notify_all();
+        job(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        const auto started = std::remove_if(jobs_.begin(), jobs_.end(), [&](const entry& e) { return e.owner == &b; });
+        b.pending -= static_cast<unsigned>(jobs_.end() - started);
+        jobs_.erase(started, jobs_.end());
+
+        b.done.wait(lock, [&] { return b.pending == 0; });
+    }
+
+private:
+    struct batch
+    {
+        const std::function<void(unsigned)>* job;
+        unsigned pending; // Jobs queued or running
+        std::condition_variable done;
+    };
+
+    struct entry
+    {
+        batch* owner;
+        unsigned index;
+    };
+
+    thread_pool() = default;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+
+        wake_.notify_all();
+
+        for (auto& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        for (;;)
+        {
+            wake_.wait(lock, [&] { return stop_ || !jobs_.empty(); });
+
+            if (jobs_.empty())
+            {
+                return;
+            }
+
+            const entry e = jobs_.front();
+            jobs_.pop_front();
+
+            lock.unlock();
+            (*e.owner->job)(e.index);
+            lock.lock();
+
+            if (--e.owner->pending == 0)
+            {
+                e.owner->done.notify_one();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<entry> jobs_;
+    std::vector<std::thread> workers_;
+    bool stop_ = false;
+};
+
+// Runs f(task) for every task in [0, tasks) on up to threads threads, the calling thread included.
+// Each worker starts with a contiguous range of tasks, so neighbouring chunks of the input stay
+// on one core, and steals from the back of the others once its own range is done.
+// If a worker can not be started or is busy its tasks are stolen by the others.
+// Throws std::bad_alloc before any task has run.
+template <typename F>
+void run_tasks(unsigned threads, std::size_t tasks, F f)
+{
+    if (threads <= 1 || tasks <= 1)
+    {
+        for (std::size_t task = 0; task < tasks; ++task)
+        {
+            f(task);
+        }
+
+        return;
+    }
+
+    std::vector<task_queue> queues(threads);
+
+    for (unsigned i = 0; i < threads; ++i)
+    {
+        const auto front = static_cast<std::uint32_t>(tasks * i / threads);
+        const auto back = static_cast<std::uint32_t>(tasks * (i + 1) / threads);
+        queues[i].bounds.store(pack_bounds(front, back), std::memory_order_relaxed);
+    }
+
+    const std::function<void(unsigned)> work = [&](unsigned self)
+    {
+        std::size_t task;
+
+        while (take_task(queues[self], false, task))
+        {
+            f(task);
+        }
+
+        // Tasks are never added, so one pass over the others finds all that are left
+        for (unsigned i = 1; i < threads; ++i)
+        {
+            task_queue& victim = queues[(self + i) % threads];
+
+            while (take_task(victim, true, task))
+            {
+                f(task);
+            }
+        }
+    };
+
+    thread_pool::instance().run(threads, work);
+}
+
+// Characters that can be part of a number, which would make the split ambiguous
+bool is_number_char(char c) noexcept
+{
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           c == '.' || c == '-' || c == '+' || c == '(' || c == ')' || c == '_';
+}
+
+// Appends the fields of [first, last) to values, stopping at the first one that fails
+template <typename T>
+boost::charconv::from_chars_result parse_fields(const char* first, const char* last, char delimiter, boost::charconv::chars_format fmt,
+                                                std::vector<T>& values) noexcept
+{
+    while (first != last)
+    {
+        T value {};
+        auto r = boost::charconv::from_chars(first, last, value, fmt);
+
+        if (!r)
+        {
+            return r;
+        }
+
+        if (r.ptr != last && *r.ptr != delimiter)
+        {
+            return {r.ptr, std::errc::invalid_argument};
+        }
+
+        BOOST_TRY
+        {
+            values.push_back(value);
+        }
+        BOOST_CATCH (const std::bad_alloc&)
+        {
+            return {first, std::errc::not_enough_memory};
+        }
+        BOOST_CATCH_END
+
+        first = r.ptr == last ? last : r.ptr + 1;
+    }
+
+    return {last, std::errc()};
+}
+
+template <typename T>
+struct chunk
+{
+    const char* first;
+    const char* last;
+    std::vector<T> values;
+    boost::charconv::from_chars_result result;
+};
+
+template <typename T>
+boost::charconv::from_chars_result parallel_from_chars_impl(const char* first, const char* last, char delimiter, std::vector<T>& out,
+                                                            unsigned threads, boost::charconv::chars_format fmt) noexcept
+{
+    if (is_number_char(delimiter))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const auto size = static_cast<std::size_t>(last - first);
+    threads = resolve_threads(threads);
+
+    const std::size_t tasks = (std::min)(threads * chunks_per_thread, (std::max)(size / min_chunk_size, static_cast<std::size_t>(1)));
+
+    // On one thread the chunks would only add the copy at the end
+    if (threads == 1 || tasks == 1)
+    {
+        return parse_fields(first, last, delimiter, fmt, out);
+    }
+
+    threads = static_cast<unsigned>((std::min)(static_cast<std::size_t>(threads), tasks));
+
+    BOOST_TRY
+    {
+        std::vector<chunk<T>> chunks(tasks);
+
+        // Every chunk but the first starts right after a delimiter, so no field is split
+        const char* begin = first;
+
+        for (std::size_t i = 0; i < tasks; ++i)
+        {
+            const char* end = i + 1 == tasks ? last : first + size / tasks * (i + 1);
+
+            if (end <= begin)
+            {
+                end = begin;
+            }
+            else if (end != last)
+            {
+                const void* delim = std::memchr(end, delimiter, static_cast<std::size_t>(last - end));
+                end = delim == nullptr ? last : static_cast<const char*>(delim) + 1;
+            }
+
+            chunks[i].first = begin;
+            chunks[i].last = end;
+            begin = end;
+        }
+
+        // The chunks after one that failed are not needed
+        std::atomic<std::size_t> first_failed {tasks};
+
+        run_tasks(threads, tasks, [&](std::size_t i)
+        {
+            if (i > first_failed.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            chunk<T>& c = chunks[i];
+            c.result = parse_fields(c.first, c.last, delimiter, fmt, c.values);
+
+            if (!c.result)
+            {
+                std::size_t current = first_failed.load(std::memory_order_relaxed);
+                while (i < current && !first_failed.compare_exchange_weak(current, i, std::memory_order_relaxed))
+                {
+                }
+            }
+        });
+
+        const std::size_t failed = first_failed.load(std::memory_order_relaxed);
+        const std::size_t used = failed == tasks ? tasks : failed + 1;
+
+        std::vector<std::size_t> offsets(used);
+        std::size_t total = out.size();
+
+        for (std::size_t i = 0; i < used; ++i)
+        {
+            offsets[i] = total;
+            total += chunks[i].values.size();
+        }
+
+        out.resize(total);
+
+        run_tasks(threads, used, [&](std::size_t i)
+        {
+            std::copy(chunks[i].values.begin(), chunks[i].values.end(), out.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+        });
+
+        return failed == tasks ? boost::charconv::from_chars_result {last, std::errc()} : chunks[failed].result;
+    }
+    BOOST_CATCH (const std::bad_alloc&)
+    {
+        return {first, std::errc::not_enough_memory};
+    }
+    BOOST_CATCH_END
+}
+
+struct format_spec
+{
+    boost::charconv::chars_format fmt;
+    int precision;
+    bool shortest; // precision is not passed to to_chars
+};
+
+template <typename T>
+boost::charconv::to_chars_result format_value(char* first, char* last, T value, const format_spec& spec) noexcept
+{
+    return spec.shortest ? boost::charconv::to_chars(first, last, value, spec.fmt) :
+                           boost::charconv::to_chars(first, last, value, spec.fmt, spec.precision);
+}
+
+// What a loop over to_chars does
+template <typename T>
+boost::charconv::to_chars_result format_values(char* first, char* last, const T* values, std::size_t count, char delimiter,
+                                               const format_spec& spec) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i != 0)
+        {
+            if (first == last)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            *first++ = delimiter;
+        }
+
+        const auto r = format_value(first, last, values[i], spec);
+
+        if (!r)
+        {
+            return r;
+        }
+
+        first = r.ptr;
+    }
+
+    return {first, std::errc()};
+}
+
+// The text of one slice of the values. The buffer is sized up front from limits<T>::max_chars,
+// which is enough for everything but fixed notation of large or small values, and doubled when it is not.
+struct segment
+{
+    std::unique_ptr<char[]> data;
+    std::size_t capacity;
+    std::size_t size;
+    std::errc ec;
+};
+
+bool grow(segment& s, std::size_t capacity) noexcept
+{
+    std::unique_ptr<char[]> data(new (std::nothrow) char[capacity]);
+
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    if (s.size != 0)
+    {
+        std::memcpy(data.get(), s.data.get(), s.size);
+    }
+
+    s.data = std::move(data);
+    s.capacity = capacity;
+    return true;
+}
+
+// Every value but the first of all is preceded by the delimiter, so the segments only need to be put together
+template <typename T>
+void format_segment(segment& s, const T* values, std::size_t count, bool leading_delimiter, char delimiter, const format_spec& spec) noexcept
+{
+    std::size_t per_value = static_cast<std::size_t>(boost::charconv::limits<T>::max_chars) + 1;
+
+    if (!spec.shortest && spec.precision > 0)
+    {
+        per_value += static_cast<std::size_t>(spec.precision);
+    }
+
+    s.size = 0;
+    s.ec = std::errc();
+
+    if (!grow(s, count * per_value))
+    {
+        s.ec = std::errc::not_enough_memory;
+        return;
+    }
+
+    std::size_t i = 0;
+
+    while (i < count)
+    {
+        char* const first = s.data.get() + s.size;
+        char* const last = s.data.get() + s.capacity;
+        const bool delimited = leading_delimiter || i != 0;
+
+        if (last - first > static_cast<std::ptrdiff_t>(delimited))
+        {
+            const auto r = format_value(first + static_cast<int>(delimited), last, values[i], spec);
+
+            if (r)
+            {
+                if (delimited)
+                {
+                    *first = delimiter;
+                }
+
+                s.size = static_cast<std::size_t>(r.ptr - s.data.get());
+                ++i;
+                continue;
+            }
+
+            if (r.ec != std::errc::value_too_large)
+            {
+                s.ec = r.ec;
+                return;
+            }
+        }
+
+        if (!grow(s, s.capacity * 2))
+        {
+            s.ec = std::errc::not_enough_memory;
+            return;
+        }
+    }
+}
+
+template <typename T>
+boost::charconv::to_chars_result parallel_to_chars_impl(char* first, char* last, const T* values_first, const T* values_last, char delimiter,
+                                                        unsigned threads, const format_spec& spec) noexcept
+{
+    const auto count = static_cast<std::size_t>(values_last - values_first);
+    threads = resolve_threads(threads);
+
+    const std::size_t tasks = (std::min)(threads * chunks_per_thread, (std::max)(count / min_slice_size, static_cast<std::size_t>(1)));
+
+    // On one thread the segments would only add the copy at the end
+    if (threads == 1 || tasks == 1)
+    {
+        return format_values(first, last, values_first, count, delimiter, spec);
+    }
+
+    threads = static_cast<unsigned>((std::min)(static_cast<std::size_t>(threads), tasks));
+
+    BOOST_TRY
+    {
+        std::vector<segment> segments(tasks);
+
+        run_tasks(threads, tasks, [&](std::size_t i)
+        {
+            const std::size_t begin = count / tasks * i;
+            const std::size_t end = i + 1 == tasks ? count : count / tasks * (i + 1);
+            format_segment(segments[i], values_first + begin, end - begin, i != 0, delimiter, spec);
+        });
+
+        // The offset of each segment in the output is the sum of the lengths of the ones before it
+        std::vector<std::size_t> offsets(tasks);
+        std::size_t total = 0;
+
+        for (std::size_t i = 0; i < tasks; ++i)
+        {
+            if (segments[i].ec != std::errc())
+            {
+                return {last, segments[i].ec};
+            }
+
+            offsets[i] = total;
+            total += segments[i].size;
+        }
+
+        if (total > static_cast<std::size_t>(last - first))
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        run_tasks(threads, tasks, [&](std::size_t i)
+        {
+            std::memcpy(first + offsets[i], segments[i].data.get(), segments[i].size);
+        });
+
+        return {first + total, std::errc()};
+    }
+    BOOST_CATCH (const std::bad_alloc&)
+    {
+        return {last, std::errc::not_enough_memory};
+    }
+    BOOST_CATCH_END
+}
+
+} // Namespace
+
+boost::charconv::from_chars_result boost::charconv::parallel_from_chars(const char* first, const char* last, char delimiter, std::vector<float>& out,
+                                                                        unsigned threads, chars_format fmt) noexcept
+{
+    return parallel_from_chars_impl(first, last, delimiter, out, threads, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::parallel_from_chars(const char* first, const char* last, char delimiter, std::vector<double>& out,
+                                                                        unsigned threads, chars_format fmt) noexcept
+{
+    return parallel_from_chars_impl(first, last, delimiter, out, threads, fmt);
+}
+
+boost::charconv::to_chars_result boost::charconv::parallel_to_chars(char* first, char* last, const float* values_first, const float* values_last, char delimiter,
+                                                                    unsigned threads, chars_format fmt) noexcept
+{
+    return parallel_to_chars_impl(first, last, values_first, values_last, delimiter, threads, format_spec {fmt, 0, true});
+}
+
+boost::charconv::to_chars_result boost::charconv::parallel_to_chars(char* first, char* last, const double* values_first, const double* values_last, char delimiter,
+                                                                    unsigned threads, chars_format fmt) noexcept
+{
+    return parallel_to_chars_impl(first, last, values_first, values_last, delimiter, threads, format_spec {fmt, 0, true});
+}
+
+boost::charconv::to_chars_result boost::charconv::parallel_to_chars(char* first, char* last, const float* values_first, const float* values_last, char delimiter,
+                                                                    unsigned threads, chars_format fmt, int precision) noexcept
+{
+    return parallel_to_chars_impl(first, last, values_first, values_last, delimiter, threads, format_spec {fmt, precision, false});
+}
+
+boost::charconv::to_chars_result boost::charconv::parallel_to_chars(char* first, char* last, const double* values_first, const double* values_last, char delimiter,
+                                                                    unsigned threads, chars_format fmt, int precision) noexcept
+{
+    return parallel_to_chars_impl(first, last, values_first, values_last, delimiter, threads, format_spec {fmt, precision, false});
+}
@@ -0,0 +1,42 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/detail/stats.hpp>
+#include <boost/charconv/stats.hpp>
+
+#ifdef BOOST_CHARCONV_ENABLE_STATS
+
+namespace {
+
+thread_local boost::charconv::path_stats thread_counters {};
+
+}
+
+boost::charconv::path_stats& boost::charconv::detail::thread_stats() noexcept
+{
+    return thread_counters;
+}
+
+boost::charconv::path_stats boost::charconv::stats() noexcept
+{
+    return thread_counters;
+}
+
+void boost::charconv::reset_stats() noexcept
+{
+    thread_counters = path_stats {};
+}
+
+#else
+
+boost::charconv::path_stats boost::charconv::stats() noexcept
+{
+    return path_stats {};
+}
+
+void boost::charconv::reset_stats() noexcept
+{
+}
+
+#endif // BOOST_CHARCONV_ENABLE_STATS
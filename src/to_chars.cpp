@@ -8,6 +8,9 @@
 #include "to_chars_float_impl.hpp"
 #include <boost/charconv/to_chars.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <new>
+#include <string>
 #include <limits>
 #include <cstring>
 #include <cstdio>
@@ -265,15 +268,34 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
         }
     }
 
+    // The digits are printed before the length of the output is known, and a few characters past the end of it
+    // may be written as scratch, so buffers shorter than the longest output are written through one that is not
+    constexpr std::ptrdiff_t dragon_box_max_chars = 32;
+
+    template <typename Float, typename Significand>
+    to_chars_result dragon_box_print_bounded(Significand significand, int exponent, char* first, char* last, chars_format fmt) noexcept
+    {
+        char buffer[dragon_box_max_chars];
+        const auto r = dragon_box_print_chars<Float, dragonbox_float_traits<Float>>(significand, exponent, buffer, buffer + sizeof(buffer), fmt);
+        const auto num_chars = r.ptr - buffer;
+
+        if (num_chars > last - first)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        std::memcpy(first, buffer, static_cast<std::size_t>(num_chars));
+        return {first + num_chars, std::errc()};
+    }
+
     template <>
     to_chars_result dragon_box_print_chars<float, dragonbox_float_traits<float>>(std::uint32_t s32, int exponent, char* first, char* last, chars_format fmt) noexcept
     {
         auto buffer = first;
 
-        const std::ptrdiff_t total_length = total_buffer_length(9, exponent, false);
-        if (total_length > (last - first))
+        if (last - first < dragon_box_max_chars)
         {
-            return {last, std::errc::value_too_large};
+            return dragon_box_print_bounded<float>(s32, exponent, first, last, fmt);
         }
 
         // Print significand.
@@ -313,10 +335,9 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
     {
         auto buffer = first;
 
-        const std::ptrdiff_t total_length = total_buffer_length(17, exponent, false);
-        if (total_length > (last - first))
+        if (last - first < dragon_box_max_chars)
         {
-            return {last, std::errc::value_too_large};
+            return dragon_box_print_bounded<double>(significand, exponent, first, last, fmt);
         }
 
         // Print significand by decomposing it into a 9-digit block and a 8-digit block.
@@ -626,6 +647,11 @@ boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* la
 boost::charconv::to_chars_result boost::charconv::to_chars( char* first, char* last, long double value,
                                                             boost::charconv::chars_format fmt, int precision) noexcept
 {
+    if (!boost::charconv::detail::json_to_general(fmt, std::isfinite(value)))
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
     if (std::isnan(value))
     {
         bool is_negative = false;
@@ -791,3 +817,265 @@ boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* la
     return boost::charconv::detail::to_chars_float_impl(first, last, static_cast<float>(value), fmt, precision);
 }
 #endif
+
+// Wide characters
+
+namespace {
+
+// The longest output without a precision is fixed notation of the smallest subnormal long double
+constexpr std::size_t wide_max_size = 5120;
+
+template <typename UC>
+inline boost::charconv::to_chars_result_t<UC> to_chars_wide_copy(UC* first, UC* last, const char* narrow, boost::charconv::to_chars_result r) noexcept
+{
+    if (!r)
+    {
+        return {last, r.ec};
+    }
+
+    const auto n = static_cast<std::size_t>(r.ptr - narrow);
+    boost::charconv::detail::copy_digits(first, narrow, n);
+    return {first + n, std::errc()};
+}
+
+// Formats into a heap buffer of at most max_size, for output longer than the buffer on the stack
+template <typename Real, typename... Args>
+BOOST_NOINLINE boost::charconv::to_chars_result to_chars_heap(std::string& storage, std::size_t size, Real value, Args... args) noexcept
+{
+    BOOST_TRY
+    {
+        storage.resize(size);
+    }
+    BOOST_CATCH (const std::bad_alloc&)
+    {
+        return {nullptr, std::errc::not_enough_memory};
+    }
+    BOOST_CATCH_END
+
+    return boost::charconv::to_chars(&storage[0], &storage[0] + storage.size(), value, args...);
+}
+
+// The floating point formatters only write char, so unlike the integers the text takes two passes: the value is
+// formatted into a buffer on the stack of at most the size of [first, last), which is then widened into it.
+// Only fixed notation of large exponents or precisions is longer than the buffer, which then takes a heap
+// allocation of at most max_size.
+template <typename UC, typename Real, typename... Args>
+boost::charconv::to_chars_result_t<UC> to_chars_wide_impl(UC* first, UC* last, std::size_t max_size, Real value, Args... args) noexcept
+{
+    if (first > last)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    const auto size = static_cast<std::size_t>(last - first);
+
+    char buffer[256];
+    auto r = boost::charconv::to_chars(buffer, buffer + (size < sizeof(buffer) ? size : sizeof(buffer)), value, args...);
+
+    if (BOOST_UNLIKELY(r.ec == std::errc::value_too_large && size > sizeof(buffer)))
+    {
+        std::string storage;
+        r = to_chars_heap(storage, size < max_size ? size : max_size, value, args...);
+        return to_chars_wide_copy(first, last, storage.data(), r);
+    }
+
+    return to_chars_wide_copy(first, last, buffer, r);
+}
+
+}
+
+boost::charconv::to_chars_result_t<char16_t> boost::charconv::to_chars(char16_t* first, char16_t* last, float value,
+                                                                       boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<char16_t> boost::charconv::to_chars(char16_t* first, char16_t* last, double value,
+                                                                       boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<char16_t> boost::charconv::to_chars(char16_t* first, char16_t* last, long double value,
+                                                                       boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<char16_t> boost::charconv::to_chars(char16_t* first, char16_t* last, float value,
+                                                                       boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<char16_t> boost::charconv::to_chars(char16_t* first, char16_t* last, double value,
+                                                                       boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<char16_t> boost::charconv::to_chars(char16_t* first, char16_t* last, long double value,
+                                                                       boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<char32_t> boost::charconv::to_chars(char32_t* first, char32_t* last, float value,
+                                                                       boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<char32_t> boost::charconv::to_chars(char32_t* first, char32_t* last, double value,
+                                                                       boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<char32_t> boost::charconv::to_chars(char32_t* first, char32_t* last, long double value,
+                                                                       boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<char32_t> boost::charconv::to_chars(char32_t* first, char32_t* last, float value,
+                                                                       boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<char32_t> boost::charconv::to_chars(char32_t* first, char32_t* last, double value,
+                                                                       boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<char32_t> boost::charconv::to_chars(char32_t* first, char32_t* last, long double value,
+                                                                       boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<wchar_t> boost::charconv::to_chars(wchar_t* first, wchar_t* last, float value,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<wchar_t> boost::charconv::to_chars(wchar_t* first, wchar_t* last, double value,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<wchar_t> boost::charconv::to_chars(wchar_t* first, wchar_t* last, long double value,
+                                                                      boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size, value, fmt);
+}
+
+boost::charconv::to_chars_result_t<wchar_t> boost::charconv::to_chars(wchar_t* first, wchar_t* last, float value,
+                                                                      boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<wchar_t> boost::charconv::to_chars(wchar_t* first, wchar_t* last, double value,
+                                                                      boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+boost::charconv::to_chars_result_t<wchar_t> boost::charconv::to_chars(wchar_t* first, wchar_t* last, long double value,
+                                                                      boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_wide_impl(first, last, wide_max_size + (precision > 0 ? static_cast<std::size_t>(precision) : 0U), value, fmt, precision);
+}
+
+// JSON
+
+namespace {
+
+// Whether the shortest representation has neither a fraction nor an exponent. For float and double
+// this follows from the paths of to_chars_float_impl: below the maximum of the unsigned integer of the
+// same size an integer value is written by to_chars_fixed_impl or to_chars_integer_impl, above it by
+// dragonbox with an exponent.
+inline bool is_integer_output(const char*, const char*, float value) noexcept
+{
+    return value == std::trunc(value) && std::abs(value) < static_cast<float>((std::numeric_limits<std::uint32_t>::max)());
+}
+
+inline bool is_integer_output(const char*, const char*, double value) noexcept
+{
+    return value == std::trunc(value) && std::abs(value) < static_cast<double>((std::numeric_limits<std::uint64_t>::max)());
+}
+
+// The other types are written by ryu or printf, so the text is searched instead
+template <typename Real>
+bool is_integer_output(const char* first, const char* last, Real) noexcept
+{
+    for (; first != last; ++first)
+    {
+        if (*first == '.' || *first == 'e' || *first == 'E')
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename Real>
+boost::charconv::to_chars_result to_chars_json_impl(char* first, char* last, Real value, const boost::charconv::json_options& options) noexcept
+{
+    if (!std::isfinite(value))
+    {
+        if (options.nonfinite != boost::charconv::json_nonfinite::null)
+        {
+            return {last, std::errc::invalid_argument};
+        }
+
+        if (last - first < 4)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        std::memcpy(first, "null", 4); // NOLINT : No null terminator is purposeful
+        return {first + 4, std::errc()};
+    }
+
+    auto r = boost::charconv::to_chars(first, last, value, boost::charconv::chars_format::json);
+
+    if (r && options.integer_fraction && is_integer_output(first, r.ptr, value))
+    {
+        if (last - r.ptr < 2)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        std::memcpy(r.ptr, ".0", 2); // NOLINT : No null terminator is purposeful
+        r.ptr += 2;
+    }
+
+    return r;
+}
+
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_json(char* first, char* last, float value,
+                                                                const boost::charconv::json_options& options) noexcept
+{
+    return to_chars_json_impl(first, last, value, options);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_json(char* first, char* last, double value,
+                                                                const boost::charconv::json_options& options) noexcept
+{
+    return to_chars_json_impl(first, last, value, options);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_json(char* first, char* last, long double value,
+                                                                const boost::charconv::json_options& options) noexcept
+{
+    return to_chars_json_impl(first, last, value, options);
+}
@@ -19,6 +19,7 @@
 #include <boost/charconv/detail/to_chars_result.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
 #include <boost/charconv/detail/fallback_routines.hpp>
+#include <boost/charconv/detail/stats.hpp>
 #include <boost/charconv/detail/buffer_sizing.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
@@ -48,6 +49,19 @@ namespace boost {
 namespace charconv {
 namespace detail {
 
+// chars_format::json writes finite values as general, which is always a valid JSON number.
+// Returns false for inf and nan, which JSON has no spelling for.
+inline bool json_to_general(chars_format& fmt, bool finite) noexcept
+{
+    if (fmt != chars_format::json)
+    {
+        return true;
+    }
+
+    fmt = chars_format::general;
+    return finite;
+}
+
 template <typename Real>
 inline to_chars_result to_chars_nonfinite(char* first, char* last, Real value, int classification) noexcept;
 
@@ -612,6 +626,11 @@ to_chars_result to_chars_fixed_impl(char* first, char* last, Real value, chars_f
     {
         if (value_struct.exponent < 0 && -value_struct.exponent < buffer_size)
         {
+            if (r.ptr == last)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
             std::memmove(r.ptr + value_struct.exponent + 1, r.ptr + value_struct.exponent,
                          static_cast<std::size_t>(-value_struct.exponent));
             std::memset(r.ptr + value_struct.exponent, '.', 1);
@@ -620,6 +639,11 @@ to_chars_result to_chars_fixed_impl(char* first, char* last, Real value, chars_f
 
         while (std::fmod(abs_value, 10) == 0)
         {
+            if (r.ptr == last)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
             *r.ptr++ = '0';
             abs_value /= 10;
         }
@@ -665,6 +689,11 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
         return {last, std::errc::value_too_large};
     }
 
+    if (!json_to_general(fmt, std::isfinite(value)))
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
     auto abs_value = std::abs(value);
     constexpr auto max_fractional_value = std::is_same<Real, double>::value ? static_cast<Real>(1e16) : static_cast<Real>(1e7);
     constexpr auto max_value = static_cast<Real>((std::numeric_limits<Unsigned_Integer>::max)());
@@ -676,10 +705,12 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
         {
             if (abs_value >= 1 && abs_value < max_fractional_value)
             {
+                BOOST_CHARCONV_STATS_TIER(fixed);
                 return to_chars_fixed_impl(first, last, value, fmt, precision);
             }
             else if (abs_value >= max_fractional_value && abs_value < max_value)
             {
+                BOOST_CHARCONV_STATS_TIER(integer_shortcut);
                 if (value < 0)
                 {
                     *first++ = '-';
@@ -688,11 +719,13 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
             }
             else
             {
+                BOOST_CHARCONV_STATS_TIER(dragonbox);
                 return boost::charconv::detail::dragonbox_to_chars(value, first, last, fmt);
             }
         }
         else if (fmt == boost::charconv::chars_format::scientific)
         {
+            BOOST_CHARCONV_STATS_TIER(dragonbox);
             return boost::charconv::detail::dragonbox_to_chars(value, first, last, fmt);
         }
     }
@@ -700,6 +733,8 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
     {
         if (fmt != boost::charconv::chars_format::hex)
         {
+            BOOST_CHARCONV_STATS_TIER(floff);
+
             if (fmt == boost::charconv::chars_format::general)
             {
                 constexpr int max_output_length = std::is_same<Real, double>::value ? 773 : 117;
@@ -710,11 +745,11 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
                     precision = max_precision;
                 }
                 char temp_buffer[max_output_length];
-                auto result = boost::charconv::detail::floff<boost::charconv::detail::main_cache_full,
-                                                             boost::charconv::detail::extended_cache_long>(value, precision,
-                                                                                                           temp_buffer,
-                                                                                                           temp_buffer + max_output_length,
-                                                                                                           fmt);
+                auto result = boost::charconv::detail::floff<boost::charconv::detail::floff_main_cache,
+                                                             boost::charconv::detail::floff_extended_cache>(value, precision,
+                                                                                                            temp_buffer,
+                                                                                                            temp_buffer + max_output_length,
+                                                                                                            fmt);
                 auto output_size = static_cast<std::size_t>(result.ptr - temp_buffer);
                 if (static_cast<std::size_t>(last - first) < output_size)
                 {
@@ -724,9 +759,9 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
                 return {first + output_size, std::errc()};
                 
             }
-            return boost::charconv::detail::floff<boost::charconv::detail::main_cache_full,
-                                                  boost::charconv::detail::extended_cache_long>(value, precision,
-                                                                                                first, last, fmt);
+            return boost::charconv::detail::floff<boost::charconv::detail::floff_main_cache,
+                                                  boost::charconv::detail::floff_extended_cache>(value, precision,
+                                                                                                 first, last, fmt);
         }
     }
 
@@ -738,6 +773,10 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
             // The dragonbox impl will return the correct type of NaN
             return boost::charconv::detail::dragonbox_to_chars(value, first, last, chars_format::general);
         case FP_ZERO:
+            if (last - first < 4 + static_cast<std::ptrdiff_t>(std::signbit(value)))
+            {
+                return {last, std::errc::value_too_large};
+            }
             if (std::signbit(value))
             {
                 *first++ = '-';
@@ -756,11 +795,15 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
 #if (BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128)
 
 template <>
-to_chars_result to_chars_float_impl(char* first, char* last, long double value, chars_format fmt, int precision) noexcept
+inline to_chars_result to_chars_float_impl(char* first, char* last, long double value, chars_format fmt, int precision) noexcept
 {
     static_assert(std::numeric_limits<long double>::is_iec559, "Long double must be IEEE 754 compliant");
 
     const auto classification = std::fpclassify(value);
+    if (!json_to_general(fmt, classification != FP_NAN && classification != FP_INFINITE))
+    {
+        return {last, std::errc::invalid_argument};
+    }
     #if BOOST_CHARCONV_LDBL_BITS == 128
     if (classification == FP_NAN || classification == FP_INFINITE)
     {
@@ -793,6 +836,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
 
     if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific)
     {
+        BOOST_CHARCONV_STATS_TIER_ATTEMPT(ryu);
         const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
 
@@ -800,6 +844,13 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
         {
             return { first + num_chars, std::errc() };
         }
+        else if (num_chars == -static_cast<int>(std::errc::value_too_large))
+        {
+            return { last, std::errc::value_too_large };
+        }
+
+        // ryu can not format the value, and printf counts it instead
+        BOOST_CHARCONV_STATS_FALLBACK();
     }
     else if (fmt == boost::charconv::chars_format::hex)
     {
@@ -807,6 +858,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
     }
     else if (fmt == boost::charconv::chars_format::fixed)
     {
+        BOOST_CHARCONV_STATS_TIER_ATTEMPT(ryu);
         const auto fd128 = boost::charconv::detail::ryu::long_double_to_fd128(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
 
@@ -818,6 +870,8 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
         {
             return { last, std::errc::value_too_large };
         }
+
+        BOOST_CHARCONV_STATS_FALLBACK();
     }
 
     // Fallback to printf methods
@@ -829,7 +883,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
 #ifdef BOOST_CHARCONV_HAS_FLOAT128
 
 template <>
-to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, chars_format fmt, int precision) noexcept
+inline to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, chars_format fmt, int precision) noexcept
 {
     // Sanity check our bounds
     if (first >= last)
@@ -839,6 +893,11 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
 
     char* const original_first = first;
 
+    if (!json_to_general(fmt, !isnanq(value) && !isinfq(value)))
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
     if (isnanq(value))
     {
         return boost::charconv::detail::to_chars_nonfinite(first, last, value, FP_NAN);
@@ -858,6 +917,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
 
     if ((fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific))
     {
+        BOOST_CHARCONV_STATS_TIER_ATTEMPT(ryu);
         const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
 
@@ -865,10 +925,12 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
         {
             return { first + num_chars, std::errc() };
         }
-        else if (num_chars == -1)
+        else if (num_chars == -1 || num_chars == -static_cast<int>(std::errc::value_too_large))
         {
             return {last, std::errc::value_too_large};
         }
+
+        BOOST_CHARCONV_STATS_FALLBACK();
     }
     else if (fmt == boost::charconv::chars_format::hex)
     {
@@ -876,6 +938,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
     }
     else if (fmt == boost::charconv::chars_format::fixed)
     {
+        BOOST_CHARCONV_STATS_TIER_ATTEMPT(ryu);
         const auto fd128 = boost::charconv::detail::ryu::float128_to_fd128(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
 
@@ -887,6 +950,8 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
         {
             return { last, std::errc::value_too_large };
         }
+
+        BOOST_CHARCONV_STATS_FALLBACK();
     }
 
     first = original_first;
@@ -902,6 +967,10 @@ template <typename T>
 to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, chars_format fmt, int precision) noexcept
 {
     const auto classification = std::fpclassify(value);
+    if (!json_to_general(fmt, classification != FP_NAN && classification != FP_INFINITE))
+    {
+        return {last, std::errc::invalid_argument};
+    }
 
     if (classification == FP_NAN || classification == FP_INFINITE)
     {
@@ -918,6 +987,7 @@ to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, cha
 
     if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific)
     {
+        BOOST_CHARCONV_STATS_TIER_ATTEMPT(ryu);
         const auto fd128 = boost::charconv::detail::ryu::float16_t_to_fd128(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
 
@@ -925,6 +995,12 @@ to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, cha
         {
             return { first + num_chars, std::errc() };
         }
+        else if (num_chars == -static_cast<int>(std::errc::value_too_large))
+        {
+            return { last, std::errc::value_too_large };
+        }
+
+        BOOST_CHARCONV_STATS_FALLBACK();
     }
     else if (fmt == boost::charconv::chars_format::hex)
     {
@@ -932,6 +1008,7 @@ to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, cha
     }
     else if (fmt == boost::charconv::chars_format::fixed)
     {
+        BOOST_CHARCONV_STATS_TIER_ATTEMPT(ryu);
         const auto fd128 = boost::charconv::detail::ryu::float16_t_to_fd128(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
 
@@ -943,6 +1020,8 @@ to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, cha
         {
             return { last, std::errc::value_too_large };
         }
+
+        BOOST_CHARCONV_STATS_FALLBACK();
     }
 
     // Fallback to printf methods
@@ -0,0 +1,132 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+
+// Inputs are only captured if the library was compiled with BOOST_CHARCONV_ENABLE_CAPTURE,
+// so every test has to hold in both configurations
+
+static const char* path = "capture_test_output.txt";
+
+// Exactly halfway between two doubles with too many digits to decide without arbitrary precision
+static const char* halfway = "9007199254740993.0000000000000000001";
+
+static void parse(const char* str)
+{
+    double v {};
+    const auto r = boost::charconv::from_chars(str, str + std::strlen(str), v);
+    BOOST_TEST(r);
+}
+
+static std::vector<std::string> read_lines()
+{
+    std::vector<std::string> lines;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+void test_capture()
+{
+    std::remove(path);
+
+    // Fast paths are never captured
+    parse("1.5");
+    parse("1.7976931348623157e308");
+
+    parse(halfway);
+    const std::string long_input = "-" + std::string(halfway, 17) + std::string(200, '0') + "1";
+    parse(long_input.c_str());
+
+    auto r = boost::charconv::drain_captured_inputs(path);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.records, 2U);
+
+    auto lines = read_lines();
+    BOOST_TEST_EQ(lines.size(), 2U);
+    if (lines.size() == 2U)
+    {
+        BOOST_TEST_EQ(lines[0], std::string("bigint double ") + halfway);
+
+        // Long inputs are truncated
+        BOOST_TEST_EQ(lines[1].compare(0, 31, "bigint double -9007199254740993"), 0);
+        BOOST_TEST_LE(lines[1].size(), 14U + 128U);
+    }
+
+    // Draining empties the buffer, and further drains append
+    r = boost::charconv::drain_captured_inputs(path);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.records, 0U);
+
+    parse(halfway);
+    r = boost::charconv::drain_captured_inputs(path);
+    BOOST_TEST_EQ(r.records, 1U);
+    BOOST_TEST_EQ(read_lines().size(), 3U);
+
+    // Only the most recent records are kept
+    for (int i = 0; i < 1000; ++i)
+    {
+        parse(halfway);
+    }
+    r = boost::charconv::drain_captured_inputs(path);
+    BOOST_TEST(r);
+    BOOST_TEST_GT(r.records, 0U);
+    BOOST_TEST_LT(r.records, 1000U);
+
+    std::remove(path);
+
+    r = boost::charconv::drain_captured_inputs("/this/directory/does/not/exist/capture.txt");
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.records, 0U);
+
+    parse(halfway);
+    r = boost::charconv::drain_captured_inputs("/this/directory/does/not/exist/capture.txt");
+    BOOST_TEST(!r);
+    BOOST_TEST_EQ(r.records, 0U);
+}
+
+void test_disabled()
+{
+    parse(halfway);
+
+    const auto r = boost::charconv::drain_captured_inputs(path);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.records, 0U);
+
+    // Nothing to write so the file is not created
+    std::ifstream file(path);
+    BOOST_TEST(!file.is_open());
+}
+
+int main()
+{
+    std::remove(path);
+
+    parse(halfway);
+    const bool enabled = boost::charconv::drain_captured_inputs(path).records != 0;
+    std::remove(path);
+
+    if (enabled)
+    {
+        test_capture();
+    }
+    else
+    {
+        test_disabled();
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,153 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The tables used with BOOST_CHARCONV_COMPACT_TABLES must reproduce the full ones exactly.
+// The comparisons are done directly on the headers, so they run in both configurations.
+
+#include <boost/charconv/detail/fast_float/compact_table.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/dragonbox/floff.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <cmath>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+
+using namespace boost::charconv::detail;
+
+void test_fast_float_powers()
+{
+    using fast_float::powers;
+
+    for (int q = powers::smallest_power_of_five; q <= powers::largest_power_of_five; ++q)
+    {
+        const auto index = static_cast<std::size_t>(2 * (q - powers::smallest_power_of_five));
+        const auto compact = fast_float::compact_power_of_five_128(q);
+
+        if (!BOOST_TEST_EQ(compact.high, powers::power_of_five_128[index]) ||
+            !BOOST_TEST_EQ(compact.low, powers::power_of_five_128[index + 1]))
+        {
+            std::cerr << "q: " << q << std::endl;
+        }
+    }
+}
+
+void test_compressed_cache()
+{
+    for (int k = main_cache_holder::min_k; k <= main_cache_holder::max_k; ++k)
+    {
+        const auto full = main_cache_holder::cache[static_cast<std::size_t>(k - main_cache_holder::min_k)];
+        const auto compact = compressed_cache_detail::get_cache(k);
+
+        if (!BOOST_TEST_EQ(compact.high, full.high) || !BOOST_TEST_EQ(compact.low, full.low))
+        {
+            std::cerr << "k: " << k << std::endl;
+        }
+    }
+}
+
+void test_dragonbox_cache_policy()
+{
+    using policy_impl::cache::full;
+    using policy_impl::cache::compact;
+
+    for (int k = cache_holder_ieee754_binary64::min_k; k <= cache_holder_ieee754_binary64::max_k; ++k)
+    {
+        const auto a = full::get_cache<ieee754_binary64>(k);
+        const auto b = compact::get_cache<ieee754_binary64>(k);
+
+        if (!BOOST_TEST_EQ(a.high, b.high) || !BOOST_TEST_EQ(a.low, b.low))
+        {
+            std::cerr << "k: " << k << std::endl;
+        }
+    }
+
+    for (int k = cache_holder_ieee754_binary32::min_k; k <= cache_holder_ieee754_binary32::max_k; ++k)
+    {
+        BOOST_TEST_EQ(full::get_cache<ieee754_binary32>(k), compact::get_cache<ieee754_binary32>(k));
+    }
+}
+
+// The super compact extended cache has segments of 252 digits, so precisions above about 40
+// go through code paths that extended_cache_long never reaches
+void test_floff_super_compact()
+{
+    std::mt19937_64 rng(42);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const auto bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (!std::isnormal(value))
+        {
+            continue;
+        }
+
+        for (int precision = 17; precision < 300; precision += 7)
+        {
+            char buffer[400];
+            char expected[400];
+
+            const auto r = floff<main_cache_compressed, extended_cache_super_compact>(value, precision, buffer, buffer + sizeof(buffer),
+                                                                                      boost::charconv::chars_format::scientific);
+            *r.ptr = '\0';
+            std::snprintf(expected, sizeof(expected), "%.*e", precision, value);
+
+            if (!BOOST_TEST_CSTR_EQ(buffer, expected))
+            {
+                std::cerr << "Precision: " << precision << std::endl;
+            }
+        }
+    }
+}
+
+// Goes through whichever tables the library was built with
+template <typename T>
+void test_roundtrip()
+{
+    std::mt19937_64 rng(42);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        const auto bits = rng();
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (!std::isnormal(value))
+        {
+            continue;
+        }
+
+        char buffer[1100];
+        T roundtrip;
+
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        BOOST_TEST(boost::charconv::from_chars(buffer, r.ptr, roundtrip));
+        BOOST_TEST_EQ(value, roundtrip);
+
+        // Large precisions use floff
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific, 60);
+        BOOST_TEST(r);
+        BOOST_TEST(boost::charconv::from_chars(buffer, r.ptr, roundtrip));
+        BOOST_TEST_EQ(value, roundtrip);
+    }
+}
+
+int main()
+{
+    test_fast_float_powers();
+    test_compressed_cache();
+    test_dragonbox_cache_policy();
+    test_floff_super_compact();
+
+    test_roundtrip<float>();
+    test_roundtrip<double>();
+
+    return boost::report_errors();
+}
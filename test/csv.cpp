@@ -0,0 +1,226 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+using boost::charconv::csv_column;
+using boost::charconv::csv_options;
+using boost::charconv::parse_csv;
+
+void test_basic()
+{
+    const std::string text = "1,2.5,x,18446744073709551615,0.25\n"
+                             "-9223372036854775808,-1e300,\"a,b\nc\"\"d\",0,3\r\n"
+                             "\"7\",\"1.5\",,\"12\",\"-0\"";
+
+    std::int64_t a[4] {};
+    double b[4] {};
+    std::uint64_t d[4] {};
+    float e[4] {};
+
+    const csv_column columns[] = {a, b, nullptr, d, e};
+    const auto r = parse_csv(text.data(), text.data() + text.size(), columns, 4);
+
+    BOOST_TEST(r);
+    BOOST_TEST(r.ptr == text.data() + text.size());
+    BOOST_TEST_EQ(r.rows, 3U);
+
+    BOOST_TEST_EQ(a[0], 1);
+    BOOST_TEST_EQ(a[1], (std::numeric_limits<std::int64_t>::min)());
+    BOOST_TEST_EQ(a[2], 7);
+    BOOST_TEST_EQ(b[0], 2.5);
+    BOOST_TEST_EQ(b[1], -1e300);
+    BOOST_TEST_EQ(b[2], 1.5);
+    BOOST_TEST_EQ(d[0], (std::numeric_limits<std::uint64_t>::max)());
+    BOOST_TEST_EQ(d[1], 0U);
+    BOOST_TEST_EQ(d[2], 12U);
+    BOOST_TEST_EQ(e[0], 0.25F);
+    BOOST_TEST_EQ(e[1], 3.0F);
+    BOOST_TEST_EQ(e[2], -0.0F);
+}
+
+void test_options()
+{
+    const std::string text = "id;\"value; in EUR\"\n1;1,5\n2;2,5\n";
+
+    std::int64_t id[2] {};
+    double value[2] {};
+    const csv_column columns[] = {id, value};
+
+    // A comma is not a decimal separator
+    csv_options options;
+    options.delimiter = ';';
+    options.header = true;
+
+    auto r = parse_csv(text.data(), text.data() + text.size(), columns, 2, options);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.rows, 0U);
+    BOOST_TEST_EQ(r.column, 1U);
+    BOOST_TEST_EQ(*r.ptr, ',');
+
+    const std::string text2 = "id;'value;x'\n1;1.5\n2;2.5\n";
+    options.quote = '\'';
+    r = parse_csv(text2.data(), text2.data() + text2.size(), columns, 2, options);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.rows, 2U);
+    BOOST_TEST_EQ(id[1], 2);
+    BOOST_TEST_EQ(value[1], 2.5);
+
+    // The format is passed on to from_chars
+    const std::string text3 = "1e5\n";
+    options = csv_options();
+    options.fmt = boost::charconv::chars_format::fixed;
+    const csv_column float_column[] = {value};
+    r = parse_csv(text3.data(), text3.data() + text3.size(), float_column, 2, options);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(*r.ptr, 'e');
+}
+
+struct error_case
+{
+    const char* text;
+    std::size_t rows;
+    std::size_t column;
+    std::size_t offset;
+    std::errc ec;
+};
+
+void test_errors()
+{
+    const error_case cases[] = {
+        {"1,2,3\n4,5x,6\n", 1, 1, 9, std::errc::invalid_argument},           // Characters after the number
+        {"1,2,3\n4,5\n", 1, 2, 9, std::errc::invalid_argument},              // Missing column
+        {"1,2,3\n4,5,6,7\n", 1, 2, 11, std::errc::invalid_argument},         // Extra column
+        {"1,,3\n", 0, 1, 2, std::errc::invalid_argument},                    // Empty field
+        {"1,2,3\n\n", 1, 0, 6, std::errc::invalid_argument},                 // Empty line
+        {"-,2,3\n", 0, 0, 0, std::errc::invalid_argument},                   // Sign without digits
+        {"1,\"2,3\n", 0, 1, 2, std::errc::invalid_argument},                 // Unterminated quote
+        {"1,\"2 \",3\n", 0, 1, 4, std::errc::invalid_argument},              // Space inside quotes
+        {"9223372036854775808,2,3\n", 0, 0, 19, std::errc::result_out_of_range},
+        {"1,1e999,3\n", 0, 1, 7, std::errc::result_out_of_range},
+        {"1,2,-3\n", 0, 2, 4, std::errc::invalid_argument},                  // Negative unsigned
+    };
+
+    for (const auto& c : cases)
+    {
+        std::int64_t a[4] {};
+        double b[4] {};
+        std::uint64_t d[4] {};
+        const csv_column columns[] = {a, b, d};
+
+        const auto r = parse_csv(c.text, c.text + std::strlen(c.text), columns, 4);
+
+        if (!BOOST_TEST(r.ec == c.ec) || !BOOST_TEST_EQ(r.rows, c.rows) || !BOOST_TEST_EQ(r.column, c.column) ||
+            !BOOST_TEST_EQ(static_cast<std::size_t>(r.ptr - c.text), c.offset))
+        {
+            std::cerr << "Input: " << c.text << std::endl;
+        }
+    }
+}
+
+// Large inputs are parsed in batches of max_rows
+void test_batches()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1e10, 1e10);
+
+    std::vector<std::int64_t> expected_ints;
+    std::vector<double> expected_doubles;
+    std::string text = "int,text,double\n";
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        expected_ints.push_back(static_cast<std::int64_t>(rng()));
+        expected_doubles.push_back(dist(rng));
+
+        char buffer[64];
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), expected_ints.back());
+        text.append(buffer, r.ptr);
+        text += i % 3 == 0 ? ",\"say \"\"hi\"\", twice\"," : ",plain,";
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), expected_doubles.back());
+        text.append(buffer, r.ptr);
+        text += i % 2 == 0 ? "\n" : "\r\n";
+    }
+
+    std::vector<std::int64_t> ints;
+    std::vector<double> doubles;
+
+    std::int64_t batch_ints[999];
+    double batch_doubles[999];
+    const csv_column columns[] = {batch_ints, nullptr, batch_doubles};
+
+    csv_options options;
+    options.header = true;
+
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+
+    for (;;)
+    {
+        const auto r = parse_csv(first, last, columns, 999, options);
+        ints.insert(ints.end(), batch_ints, batch_ints + r.rows);
+        doubles.insert(doubles.end(), batch_doubles, batch_doubles + r.rows);
+
+        if (r.ec != std::errc::value_too_large)
+        {
+            BOOST_TEST(r);
+            break;
+        }
+
+        BOOST_TEST_EQ(r.rows, 999U);
+        first = r.ptr;
+        options.header = false;
+    }
+
+    BOOST_TEST(ints == expected_ints);
+    BOOST_TEST(doubles == expected_doubles);
+}
+
+void test_edges()
+{
+    double values[2] {};
+    const csv_column columns[] = {values};
+
+    // No rows, with and without a header
+    auto r = parse_csv(nullptr, nullptr, columns, 2);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.rows, 0U);
+
+    csv_options options;
+    options.header = true;
+    const char* header = "x";
+    r = parse_csv(header, header + 1, columns, 2, options);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.rows, 0U);
+
+    // The last row does not need a line break
+    const char* text = "1\r\n2\r";
+    r = parse_csv(text, text + 5, columns, 2);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.rows, 2U);
+    BOOST_TEST_EQ(values[1], 2.0);
+
+    // A schema without columns
+    r = parse_csv(text, text + 5, columns, 0, 2);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+}
+
+int main()
+{
+    test_basic();
+    test_options();
+    test_errors();
+    test_batches();
+    test_edges();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,305 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <unistd.h>
+#  define BOOST_CHARCONV_TEST_FD
+#endif
+
+using boost::charconv::const_csv_column;
+using boost::charconv::csv_write_options;
+using boost::charconv::csv_writer;
+
+static std::string text_of(const csv_writer& w)
+{
+    return std::string(w.data(), w.size());
+}
+
+void test_basic()
+{
+    const std::int64_t a[] = {1, (std::numeric_limits<std::int64_t>::min)(), 0};
+    const std::uint64_t b[] = {(std::numeric_limits<std::uint64_t>::max)(), 7, 42};
+    const float c[] = {1.5F, -1e30F, 3};
+    const double d[] = {2.5, 1e-300, -0.0};
+
+    csv_writer w;
+    const char* const names[] = {"a", "b,c", "say \"hi\"", "", "d"};
+    BOOST_TEST(w.write_header(names) == std::errc());
+
+    const const_csv_column columns[] = {a, b, c, nullptr, d};
+    BOOST_TEST(w.write_rows(columns, 3) == std::errc());
+
+    const std::string expected = "a,\"b,c\",\"say \"\"hi\"\"\",,d\n"
+                                 "1,18446744073709551615,1.5,,2.5\n"
+                                 "-9223372036854775808,7,-1e+30,,1e-300\n"
+                                 "0,42,3,,-0\n";
+    BOOST_TEST_EQ(text_of(w), expected);
+
+    // Rows are appended, and clear() drops the text
+    BOOST_TEST(w.write_rows(columns, 1) == std::errc());
+    BOOST_TEST_EQ(text_of(w), expected + "1,18446744073709551615,1.5,,2.5\n");
+    w.clear();
+    BOOST_TEST_EQ(w.size(), 0U);
+
+    BOOST_TEST(w.write_rows(columns, 0, 1) == std::errc::invalid_argument);
+    BOOST_TEST(w.write_header(names, 0) == std::errc::invalid_argument);
+}
+
+void test_options()
+{
+    const std::int64_t a[] = {1, -2};
+    const double b[] = {1.5, 1e20};
+
+    const const_csv_column columns[] = {a, b};
+
+    csv_write_options options;
+    options.delimiter = ';';
+    options.quote = '\'';
+    options.crlf = true;
+
+    csv_writer w;
+    const char* const names[] = {"id;x", "it's"};
+    BOOST_TEST(w.write_header(names, options) == std::errc());
+    BOOST_TEST(w.write_rows(columns, 2, options) == std::errc());
+    BOOST_TEST_EQ(text_of(w), "'id;x';'it''s'\r\n1;1.5\r\n-2;1e+20\r\n");
+
+    // The format and precision are passed on to to_chars
+    w.clear();
+    options = csv_write_options();
+    options.fmt = boost::charconv::chars_format::scientific;
+    options.precision = 3;
+    BOOST_TEST(w.write_rows(columns, 2, options) == std::errc());
+    BOOST_TEST_EQ(text_of(w), "1,1.500e+00\n-2,1.000e+20\n");
+
+    w.clear();
+    options.fmt = boost::charconv::chars_format::fixed;
+    options.precision = 0;
+    BOOST_TEST(w.write_rows(columns, 2, options) == std::errc());
+    BOOST_TEST_EQ(text_of(w), "1,2\n-2,100000000000000000000\n");
+
+    // A field that to_chars can not format returns its error, and the rows before it are kept
+    const double e[] = {0.5, std::numeric_limits<double>::infinity()};
+    const const_csv_column json_columns[] = {e};
+
+    w.clear();
+    options = csv_write_options();
+    options.fmt = boost::charconv::chars_format::json;
+    BOOST_TEST(w.write_rows(json_columns, 2, options) == std::errc::invalid_argument);
+
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), e[0], options.fmt);
+    BOOST_TEST_EQ(text_of(w), std::string(buffer, r.ptr) + "\n");
+}
+
+// Fixed notation of the extreme values is far longer than the shortest one
+void test_fixed_extremes()
+{
+    const double d[] = {(std::numeric_limits<double>::max)(), (std::numeric_limits<double>::denorm_min)(),
+                        -(std::numeric_limits<double>::max)()};
+    const float f[] = {(std::numeric_limits<float>::max)(), (std::numeric_limits<float>::denorm_min)(),
+                       (std::numeric_limits<float>::lowest)()};
+
+    const const_csv_column columns[] = {d, f};
+
+    csv_write_options options;
+    options.fmt = boost::charconv::chars_format::fixed;
+
+    for (int precision = -1; precision < 40; precision += 20)
+    {
+        options.precision = precision;
+
+        // A block smaller than a row
+        csv_writer w(-1, 16);
+        BOOST_TEST(w.write_rows(columns, 3, options) == std::errc());
+
+        std::string expected;
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            char buffer[1024];
+            auto r = precision < 0 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), d[i], options.fmt) :
+                                     boost::charconv::to_chars(buffer, buffer + sizeof(buffer), d[i], options.fmt, precision);
+            BOOST_TEST(r);
+            expected.append(buffer, r.ptr);
+            expected += ',';
+
+            r = precision < 0 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), f[i], options.fmt) :
+                                boost::charconv::to_chars(buffer, buffer + sizeof(buffer), f[i], options.fmt, precision);
+            BOOST_TEST(r);
+            expected.append(buffer, r.ptr);
+            expected += '\n';
+        }
+
+        if (!BOOST_TEST_EQ(text_of(w), expected))
+        {
+            std::cerr << "Precision: " << precision << std::endl;
+        }
+    }
+}
+
+// What parse_csv writes is read back to the same values
+void test_round_trip()
+{
+    std::mt19937_64 rng(42);
+
+    constexpr std::size_t rows = 5000;
+    std::vector<std::int64_t> a(rows);
+    std::vector<std::uint64_t> b(rows);
+    std::vector<float> c(rows);
+    std::vector<double> d(rows);
+
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        a[i] = static_cast<std::int64_t>(rng()) >> (i % 64);
+        b[i] = rng() >> (i % 64);
+
+        do
+        {
+            const auto bits = rng();
+            std::memcpy(&d[i], &bits, sizeof(d[i]));
+        } while (d[i] != d[i] || d[i] == std::numeric_limits<double>::infinity() || d[i] == -std::numeric_limits<double>::infinity());
+
+        c[i] = static_cast<float>(std::ldexp(static_cast<double>(rng() % 1000000), static_cast<int>(rng() % 200) - 100));
+    }
+
+    csv_writer w;
+    const const_csv_column columns[] = {a.data(), b.data(), c.data(), d.data()};
+    BOOST_TEST(w.write_rows(columns, rows) == std::errc());
+
+    std::vector<std::int64_t> a2(rows);
+    std::vector<std::uint64_t> b2(rows);
+    std::vector<float> c2(rows);
+    std::vector<double> d2(rows);
+
+    const boost::charconv::csv_column parse_columns[] = {a2.data(), b2.data(), c2.data(), d2.data()};
+    const auto r = boost::charconv::parse_csv(w.data(), w.data() + w.size(), parse_columns, rows);
+
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.rows, rows);
+    BOOST_TEST(a == a2);
+    BOOST_TEST(b == b2);
+    BOOST_TEST(c == c2);
+    BOOST_TEST(d == d2);
+}
+
+#ifdef BOOST_CHARCONV_TEST_FD
+
+static const char* path = "csv_writer_test_output.csv";
+
+static std::string read_file()
+{
+    std::string text;
+    std::FILE* file = std::fopen(path, "rb");
+    BOOST_TEST(file != nullptr);
+
+    char buffer[4096];
+    std::size_t n;
+
+    while ((n = std::fread(buffer, 1, sizeof(buffer), file)) != 0)
+    {
+        text.append(buffer, n);
+    }
+
+    std::fclose(file);
+    return text;
+}
+
+// Writing to a file in blocks gives the same text as the buffer in memory
+void test_file()
+{
+    std::vector<std::int64_t> a(2000);
+    std::vector<double> b(2000);
+
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        a[i] = static_cast<std::int64_t>(i * i) - 1000;
+        b[i] = static_cast<double>(i) / 7;
+    }
+
+    const const_csv_column columns[] = {a.data(), b.data()};
+    const char* const names[] = {"a", "b"};
+
+    csv_writer expected;
+    expected.write_header(names);
+    expected.write_rows(columns, a.size());
+
+    for (std::size_t block_size : {1U, 64U, 4096U, 1U << 20})
+    {
+        const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        BOOST_TEST(fd >= 0);
+
+        {
+            csv_writer w(fd, block_size);
+            BOOST_TEST(w.write_header(names) == std::errc());
+
+            // In parts, so that rows are added to a partly filled block
+            BOOST_TEST(w.write_rows(columns, 500) == std::errc());
+            const const_csv_column rest[] = {a.data() + 500, b.data() + 500};
+            BOOST_TEST(w.write_rows(rest, a.size() - 500) == std::errc());
+
+            BOOST_TEST(w.size() < block_size + 64);
+            BOOST_TEST(w.flush() == std::errc());
+            BOOST_TEST_EQ(w.size(), 0U);
+        }
+
+        ::close(fd);
+
+        if (!BOOST_TEST(read_file() == text_of(expected)))
+        {
+            std::cerr << "Block size: " << block_size << std::endl;
+        }
+    }
+
+    // The destructor flushes
+    {
+        const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        {
+            csv_writer w(fd);
+            w.write_header(names);
+        }
+        ::close(fd);
+        BOOST_TEST_EQ(read_file(), "a,b\n");
+    }
+
+    // An error of the file descriptor is kept
+    {
+        const int fd = ::open(path, O_RDONLY);
+        csv_writer w(fd, 16);
+        BOOST_TEST(w.write_rows(columns, 100) == std::errc::bad_file_descriptor);
+        BOOST_TEST(w.write_header(names) == std::errc::bad_file_descriptor);
+        BOOST_TEST(w.flush() == std::errc::bad_file_descriptor);
+        ::close(fd);
+    }
+
+    std::remove(path);
+}
+
+#endif
+
+int main()
+{
+    test_basic();
+    test_options();
+    test_fixed_extremes();
+    test_round_trip();
+
+    #ifdef BOOST_CHARCONV_TEST_FD
+    test_file();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,168 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <type_traits>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static_assert(std::is_trivially_copyable<boost::charconv::decimal_token>::value, "Tokens are stored in place of values");
+
+// Converting the token must give exactly the same result as from_chars over the scanned range
+template <typename T>
+void test_matches_from_chars(const std::string& str, chars_format fmt = chars_format::general)
+{
+    boost::charconv::decimal_token token {};
+    const auto scan = boost::charconv::scan_number(str.data(), str.data() + str.size(), token, fmt);
+    if (!scan)
+    {
+        return;
+    }
+
+    BOOST_TEST_EQ(token.first, str.data());
+    BOOST_TEST_EQ(token.first + token.length, scan.ptr);
+
+    T v1 {};
+    const auto r1 = boost::charconv::from_chars(str.data(), scan.ptr, v1, fmt);
+
+    T v2 {};
+    const auto r2 = token.to(v2);
+
+    if (!(BOOST_TEST(r1.ec == r2.ec) && BOOST_TEST_EQ(r1.ptr, r2.ptr) && BOOST_TEST(v1 == v2 || (v1 != v1 && v2 != v2))))
+    {
+        std::cerr << "Mismatch for: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_int_matches_from_chars(const std::string& str)
+{
+    boost::charconv::decimal_token token {};
+    const auto scan = boost::charconv::scan_number(str, token);
+    BOOST_TEST(scan);
+    BOOST_TEST(token.kind == boost::charconv::number_kind::integer);
+
+    T v1 {};
+    const auto r1 = boost::charconv::from_chars(str.data(), scan.ptr, v1);
+
+    T v2 {};
+    const auto r2 = token.to(v2);
+
+    if (!(BOOST_TEST(r1.ec == r2.ec) && BOOST_TEST_EQ(r1.ptr, r2.ptr) && BOOST_TEST(v1 == v2)))
+    {
+        std::cerr << "Mismatch for: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_int()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (std::size_t i = 0; i < 1024; ++i)
+    {
+        test_int_matches_from_chars<T>(std::to_string(dist(rng)));
+    }
+
+    test_int_matches_from_chars<T>(std::to_string((std::numeric_limits<T>::max)()));
+    test_int_matches_from_chars<T>(std::to_string((std::numeric_limits<T>::min)()));
+    test_int_matches_from_chars<T>("0");
+    test_int_matches_from_chars<T>("-0");
+    test_int_matches_from_chars<T>("-1");
+    test_int_matches_from_chars<T>("000000000000000000000000000000042");
+    test_int_matches_from_chars<T>("9223372036854775808");
+    test_int_matches_from_chars<T>("-9223372036854775808");
+    test_int_matches_from_chars<T>("-9223372036854775809");
+    test_int_matches_from_chars<T>("18446744073709551615");
+    test_int_matches_from_chars<T>("18446744073709551616");
+    test_int_matches_from_chars<T>("123456789012345678901234567890");
+}
+
+template <typename T>
+void test_float()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<T> dist(T(-1e10), T(1e10));
+
+    for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed})
+    {
+        for (std::size_t i = 0; i < 1024; ++i)
+        {
+            char buffer[256] {};
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), dist(rng), fmt);
+            BOOST_TEST(r);
+            test_matches_from_chars<T>(std::string(buffer, r.ptr), fmt);
+        }
+    }
+
+    test_matches_from_chars<T>("3.14159265358979323846264338327950288419716939937510582097494459");
+    test_matches_from_chars<T>("-0.000000000000000000000000000000000123456789e-10");
+    test_matches_from_chars<T>("123456789012345678901234567890.5e+5");
+    test_matches_from_chars<T>("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125e-324");
+    test_matches_from_chars<T>("1e99999");
+    test_matches_from_chars<T>("-1e-99999");
+    test_matches_from_chars<T>("-inf");
+    test_matches_from_chars<T>("Infinity");
+    test_matches_from_chars<T>("nan(snan)");
+    test_matches_from_chars<T>("12.5e3", chars_format::fixed);
+    test_matches_from_chars<T>(".5");
+    test_matches_from_chars<T>("5.");
+}
+
+void test_kind_mismatch()
+{
+    boost::charconv::decimal_token token {};
+    const char* str = "1.5,2";
+    BOOST_TEST(boost::charconv::scan_number(str, str + std::strlen(str), token));
+
+    int i = 42;
+    const auto r = token.to(i);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.ptr, str);
+    BOOST_TEST_EQ(i, 42);
+
+    double d = 0;
+    BOOST_TEST(token.to(d));
+    BOOST_TEST_EQ(d, 1.5);
+
+    // A failed scan leaves the token untouched
+    const auto copy = token;
+    BOOST_TEST(!boost::charconv::scan_number(str + 3, str + std::strlen(str), token));
+    BOOST_TEST_EQ(token.first, copy.first);
+    BOOST_TEST_EQ(token.length, copy.length);
+}
+
+int main()
+{
+    // MSVC does not allow (un)signed char in uniform_int_distribution
+    #ifndef _MSC_VER
+    test_int<signed char>();
+    test_int<unsigned char>();
+    #endif
+
+    test_int<short>();
+    test_int<unsigned short>();
+    test_int<int>();
+    test_int<unsigned>();
+    test_int<long>();
+    test_int<unsigned long>();
+    test_int<long long>();
+    test_int<unsigned long long>();
+
+    test_float<float>();
+    test_float<double>();
+    test_float<long double>();
+
+    test_kind_mismatch();
+
+    return boost::report_errors();
+}
@@ -195,6 +195,27 @@ void invalid_argument_test()
     auto r9 = boost::charconv::from_chars(buffer9, buffer9 + std::strlen(buffer9), v9);
     BOOST_TEST(r9);
     BOOST_TEST_EQ(v9, static_cast<T>(123));
+
+    // A sign or nothing followed by a character that is not a digit has no digits to match
+    const char* buffer10 = "-,1";
+    T v10 = 3;
+    auto r10 = boost::charconv::from_chars(buffer10, buffer10 + std::strlen(buffer10), v10);
+    BOOST_TEST(r10.ec == std::errc::invalid_argument);
+    BOOST_TEST(r10.ptr == buffer10);
+    BOOST_TEST_EQ(v10, static_cast<T>(3));
+
+    const char* buffer11 = "x1";
+    T v11 = 3;
+    auto r11 = boost::charconv::from_chars(buffer11, buffer11 + std::strlen(buffer11), v11);
+    BOOST_TEST(r11.ec == std::errc::invalid_argument);
+    BOOST_TEST(r11.ptr == buffer11);
+    BOOST_TEST_EQ(v11, static_cast<T>(3));
+
+    const char* buffer12 = "-z";
+    T v12 = 3;
+    auto r12 = boost::charconv::from_chars(buffer12, buffer12 + std::strlen(buffer12), v12, 16);
+    BOOST_TEST(r12.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(v12, static_cast<T>(3));
 }
 
 // No overflows, negative numbers, locales, etc.
@@ -261,6 +282,7 @@ int main()
     
     invalid_argument_test<int>();
     invalid_argument_test<unsigned>();
+    invalid_argument_test<long long>();
 
     overflow_test<char>();
     overflow_test<int>();
@@ -0,0 +1,170 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static const char* const valid[] = {
+    "0", "-0", "1", "-1", "123", "0.5", "-0.5", "10.25", "1e5", "1E5", "1e+5", "1e-5", "-0.0e0", "0e0",
+    "1.5E-300", "123456789012345678901234567890", "0.000000000000000000000000000001", "1e400", "-1e-400"
+};
+
+static const char* const invalid[] = {
+    "", "-", "+1", "+0", "01", "00", "-01", "-00.5", ".5", "-.5", "1.", "-1.", "1.e5", "1e", "1E", "1e+", "1e-",
+    "inf", "-inf", "infinity", "nan", "-nan", "NaN", "nan(123)", "e5", " 1", "-a"
+};
+
+// A valid number followed by text that is not part of it, and the length of the number
+static const std::pair<const char*, std::size_t> prefixes[] = {
+    {"1,", 1}, {"0]", 1}, {"-0.5}", 4}, {"1e5 ", 3}, {"0x10", 1}, {"12a", 2}, {"1.5e5.3", 5}, {"0-", 1}
+};
+
+template <typename T>
+void test_json()
+{
+    for (const char* str : valid)
+    {
+        const char* last = str + std::strlen(str);
+
+        T expected {};
+        const auto r1 = boost::charconv::from_chars(str, last, expected, chars_format::general);
+
+        T value {};
+        const auto r2 = boost::charconv::from_chars(str, last, value, chars_format::json);
+
+        if (!(BOOST_TEST(r2.ec == r1.ec) && BOOST_TEST(r2.ptr == last) && BOOST_TEST(value == expected)))
+        {
+            std::cerr << "Input: " << str << std::endl;
+        }
+
+        const auto r3 = boost::charconv::scan_number(str, last, chars_format::json);
+        BOOST_TEST(r3.ec == std::errc());
+        BOOST_TEST(r3.ptr == last);
+    }
+
+    for (const char* str : invalid)
+    {
+        const char* last = str + std::strlen(str);
+
+        T value = 42;
+        const auto r = boost::charconv::from_chars(str, last, value, chars_format::json);
+
+        if (!(BOOST_TEST(r.ec == std::errc::invalid_argument) && BOOST_TEST(r.ptr == str) && BOOST_TEST(value == 42)))
+        {
+            std::cerr << "Input: " << str << std::endl;
+        }
+
+        BOOST_TEST(boost::charconv::from_chars_erange(str, last, value, chars_format::json).ec == std::errc::invalid_argument);
+        BOOST_TEST(boost::charconv::scan_number(str, last, chars_format::json).ec == std::errc::invalid_argument);
+    }
+
+    for (const auto& p : prefixes)
+    {
+        const char* last = p.first + std::strlen(p.first);
+
+        T expected {};
+        boost::charconv::from_chars(p.first, p.first + p.second, expected);
+
+        T value {};
+        const auto r = boost::charconv::from_chars(p.first, last, value, chars_format::json);
+
+        if (!(BOOST_TEST(r) && BOOST_TEST(r.ptr == p.first + p.second) && BOOST_TEST(value == expected)))
+        {
+            std::cerr << "Input: " << p.first << std::endl;
+        }
+    }
+
+    // general stays as lenient as before
+    for (const char* str : {"01", ".5", "1.", "inf", "nan"})
+    {
+        T value {};
+        BOOST_TEST(boost::charconv::from_chars(str, str + std::strlen(str), value, chars_format::general));
+    }
+}
+
+// The padded parser shares the grammar
+template <typename T>
+void test_json_padded()
+{
+    for (const char* str : invalid)
+    {
+        std::string buffer(str);
+        const std::size_t len = buffer.size();
+        buffer.append(boost::charconv::from_chars_padding, '0');
+
+        T value = 42;
+        const auto r = boost::charconv::from_chars_padded(buffer.data(), buffer.data() + len, value, chars_format::json);
+
+        if (!(BOOST_TEST(r.ec == std::errc::invalid_argument) && BOOST_TEST(value == 42)))
+        {
+            std::cerr << "Input: " << str << std::endl;
+        }
+    }
+
+    for (const char* str : valid)
+    {
+        std::string buffer(str);
+        const std::size_t len = buffer.size();
+        buffer.append(boost::charconv::from_chars_padding, '9');
+
+        T value {};
+        const auto r = boost::charconv::from_chars_padded(buffer.data(), buffer.data() + len, value, chars_format::json);
+        BOOST_TEST(r.ec == std::errc() || r.ec == std::errc::result_out_of_range);
+        BOOST_TEST(r.ptr == buffer.data() + len);
+    }
+}
+
+// Everything to_chars writes for a finite value is valid JSON, and reads back the same
+template <typename T>
+void test_round_trip()
+{
+    std::mt19937_64 rng(42);
+
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        const auto bits = rng();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        const T v = static_cast<T>(d);
+
+        if (v != v || v == std::numeric_limits<T>::infinity() || v == -std::numeric_limits<T>::infinity())
+        {
+            continue;
+        }
+
+        char buffer[64];
+        const auto w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v);
+        BOOST_TEST(w);
+
+        T value {};
+        const auto r = boost::charconv::from_chars(buffer, w.ptr, value, chars_format::json);
+        if (!(BOOST_TEST(r) && BOOST_TEST(r.ptr == w.ptr) && BOOST_TEST(value == v)))
+        {
+            std::cerr << "Input: " << std::string(buffer, w.ptr) << std::endl;
+        }
+    }
+}
+
+int main()
+{
+    test_json<float>();
+    test_json<double>();
+    test_json<long double>();
+
+    test_json_padded<float>();
+    test_json_padded<double>();
+
+    test_round_trip<float>();
+    test_round_trip<double>();
+
+    return boost::report_errors();
+}
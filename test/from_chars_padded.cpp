@@ -0,0 +1,144 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+// Copies str into a buffer followed by padding that would change the result if it were read as part of the number
+static std::string make_padded(const std::string& str, char pad)
+{
+    std::string buffer(str);
+    buffer.append(boost::charconv::from_chars_padding, pad);
+    return buffer;
+}
+
+template <typename T>
+void test_matches_from_chars(const std::string& str, int base = 10)
+{
+    for (std::size_t len = 0; len <= str.size(); ++len)
+    {
+        const std::string prefix = str.substr(0, len);
+
+        for (const char pad : {'9', '0', 'e', '.'})
+        {
+            const std::string buffer = make_padded(prefix, pad);
+
+            T v1 {};
+            const auto r1 = boost::charconv::from_chars(buffer.data(), buffer.data() + len, v1, base);
+
+            T v2 {};
+            const auto r2 = boost::charconv::from_chars_padded(buffer.data(), buffer.data() + len, v2, base);
+
+            if (!(BOOST_TEST(r1.ec == r2.ec) && BOOST_TEST(r1.ptr == r2.ptr) && BOOST_TEST(v1 == v2)))
+            {
+                std::cerr << "Mismatch for: " << prefix << " padded with: " << pad << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_int()
+{
+    std::uniform_int_distribution<T> dist((std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        test_matches_from_chars<T>(std::to_string(dist(rng)));
+    }
+
+    test_matches_from_chars<T>(std::to_string((std::numeric_limits<T>::max)()));
+    test_matches_from_chars<T>(std::to_string((std::numeric_limits<T>::min)()));
+    test_matches_from_chars<T>("123456789012345678901234567890");
+    test_matches_from_chars<T>("-123456789012345678901234567890");
+    test_matches_from_chars<T>("0000000000000000000000000042");
+    test_matches_from_chars<T>("12345678x");
+    test_matches_from_chars<T>("7fffffffffffffff", 16);
+}
+
+template <typename T>
+void test_matches_from_chars_float(const std::string& str, boost::charconv::chars_format fmt)
+{
+    for (std::size_t len = 0; len <= str.size(); ++len)
+    {
+        const std::string prefix = str.substr(0, len);
+
+        for (const char pad : {'9', '0', 'e', '.'})
+        {
+            const std::string buffer = make_padded(prefix, pad);
+
+            T v1 {};
+            const auto r1 = boost::charconv::from_chars(buffer.data(), buffer.data() + len, v1, fmt);
+
+            T v2 {};
+            const auto r2 = boost::charconv::from_chars_padded(buffer.data(), buffer.data() + len, v2, fmt);
+
+            if (!(BOOST_TEST(r1.ec == r2.ec) && BOOST_TEST(r1.ptr == r2.ptr) && BOOST_TEST(v1 == v2 || (v1 != v1 && v2 != v2))))
+            {
+                std::cerr << "Mismatch for: " << prefix << " padded with: " << pad << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_float()
+{
+    std::uniform_real_distribution<T> dist(T(-1e5), T(1e5));
+    const boost::charconv::chars_format formats[] = {boost::charconv::chars_format::general,
+                                                     boost::charconv::chars_format::scientific,
+                                                     boost::charconv::chars_format::fixed,
+                                                     boost::charconv::chars_format::hex};
+
+    for (const auto fmt : formats)
+    {
+        for (std::size_t i = 0; i < N / 8; ++i)
+        {
+            char buffer[256] {};
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), dist(rng), fmt);
+            BOOST_TEST(r);
+            test_matches_from_chars_float<T>(std::string(buffer, r.ptr), fmt);
+        }
+    }
+
+    test_matches_from_chars_float<T>("3.14159265358979323846264338327950288419716939937510582097494459", boost::charconv::chars_format::general);
+    test_matches_from_chars_float<T>("-0.000000000000000000000000000000000123456789e-10", boost::charconv::chars_format::general);
+    test_matches_from_chars_float<T>("123456789012345678901234567890.5e+5", boost::charconv::chars_format::general);
+    test_matches_from_chars_float<T>("1e99999", boost::charconv::chars_format::general);
+    test_matches_from_chars_float<T>("-inf", boost::charconv::chars_format::general);
+    test_matches_from_chars_float<T>("nan(snan)", boost::charconv::chars_format::general);
+}
+
+int main()
+{
+    // MSVC does not allow (un)signed char in uniform_int_distribution
+    #ifndef _MSC_VER
+    test_int<signed char>();
+    test_int<unsigned char>();
+    #endif
+
+    test_int<short>();
+    test_int<unsigned short>();
+    test_int<int>();
+    test_int<unsigned>();
+    test_int<long>();
+    test_int<unsigned long>();
+    test_int<long long>();
+    test_int<unsigned long long>();
+
+    test_float<float>();
+    test_float<double>();
+    test_float<long double>();
+
+    return boost::report_errors();
+}
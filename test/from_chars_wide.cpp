@@ -0,0 +1,196 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+static_assert(boost::charconv::detail::is_from_chars_integer<char>::value, "char is parsed as an integer");
+static_assert(!boost::charconv::detail::is_from_chars_integer<char16_t>::value, "no from_chars for char16_t values");
+static_assert(!boost::charconv::detail::is_from_chars_integer<char32_t>::value, "no from_chars for char32_t values");
+static_assert(!boost::charconv::detail::is_from_chars_integer<wchar_t>::value, "no from_chars for wchar_t values");
+
+// Code units that are not part of the basic character set, but whose low byte is a digit or a letter
+static const std::uint32_t wide_units[] = {0x0130, 0x0661, 0xFF10, 0xFF21, 0x3030, 0x10030};
+
+template <typename UC>
+std::basic_string<UC> widen(const std::string& str)
+{
+    return std::basic_string<UC>(str.begin(), str.end());
+}
+
+// The narrow text that the char overloads see for a wide text
+template <typename UC>
+std::string narrow(const std::basic_string<UC>& str)
+{
+    std::string result;
+    for (const UC c : str)
+    {
+        result += static_cast<std::uint32_t>(c) > 127U ? '#' : static_cast<char>(c);
+    }
+    return result;
+}
+
+template <typename UC, typename T, typename... Args>
+void check(const std::basic_string<UC>& str, Args... args)
+{
+    const std::string narrow_str = narrow(str);
+
+    T expected = 42;
+    const auto r1 = boost::charconv::from_chars(narrow_str.data(), narrow_str.data() + narrow_str.size(), expected, args...);
+
+    T value = 42;
+    const auto r2 = boost::charconv::from_chars(str.data(), str.data() + str.size(), value, args...);
+
+    if (!(BOOST_TEST(r2.ec == r1.ec) && BOOST_TEST_EQ(r2.ptr - str.data(), r1.ptr - narrow_str.data()) &&
+          BOOST_TEST(value == expected || (value != value && expected != expected))))
+    {
+        std::cerr << "Input: " << narrow_str << std::endl;
+    }
+}
+
+static const char* const integers[] = {
+    "0", "-0", "1", "-1", "123", "+1", "-", "", " 1", "12345678", "123456789", "1234567890123456789",
+    "18446744073709551615", "18446744073709551616", "-9223372036854775808", "-9223372036854775809",
+    "0x10", "ff", "FFzz", "1a2b3c"
+};
+
+template <typename UC, typename T>
+void test_integer()
+{
+    for (const char* str : integers)
+    {
+        for (const int base : {10, 16, 36})
+        {
+            check<UC, T>(widen<UC>(str), base);
+
+            // A wide code unit that ends the number
+            for (const std::uint32_t unit : wide_units)
+            {
+                std::basic_string<UC> wide = widen<UC>(str);
+                wide += static_cast<UC>(unit);
+                wide += static_cast<UC>('1');
+                check<UC, T>(wide, base);
+            }
+        }
+    }
+}
+
+static const char* const floats[] = {
+    "0", "-0", "1.5", "-1.5e10", "1e", "1e+", ".5", "5.", "inf", "-infinity", "nan", "nan(snan)", "nan(", "-",
+    "", "1p4", "1.8p3", "-a.bp-2", "12345678901234567890.12345678901234567890e-5", "0.000000000000000000001234",
+    "1e400", "-1e-400", "0x1p3", "01", "1,5"
+};
+
+template <typename UC, typename T>
+void test_float()
+{
+    for (const char* str : floats)
+    {
+        for (const chars_format fmt : {chars_format::general, chars_format::fixed, chars_format::scientific, chars_format::hex, chars_format::json})
+        {
+            check<UC, T>(widen<UC>(str), fmt);
+
+            for (const std::uint32_t unit : wide_units)
+            {
+                std::basic_string<UC> wide = widen<UC>(str);
+                wide += static_cast<UC>(unit);
+                wide += static_cast<UC>('1');
+                check<UC, T>(wide, fmt);
+            }
+        }
+    }
+
+    // Long enough for the narrowed text of hex not to fit on the stack
+    check<UC, T>(widen<UC>(std::string(1000, '1') + "p-3900"), chars_format::hex);
+    check<UC, T>(widen<UC>(std::string(1000, '1') + "e-990"), chars_format::general);
+}
+
+// A wide code unit in every position of a long number, which the digits are read 8 at a time from
+template <typename UC>
+void test_eight_digits()
+{
+    const std::string digits = "1234567890123456789012345.123456789012345678901234";
+
+    for (std::size_t i = 0; i < digits.size(); ++i)
+    {
+        for (const std::uint32_t unit : wide_units)
+        {
+            std::basic_string<UC> wide = widen<UC>(digits);
+            wide[i] = static_cast<UC>(unit);
+
+            check<UC, double>(wide, chars_format::general);
+            check<UC, float>(wide, chars_format::general);
+            check<UC, unsigned long long>(wide, 10);
+        }
+    }
+}
+
+template <typename UC, typename T>
+void test_random()
+{
+    std::mt19937_64 rng(42);
+
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        const auto bits = rng();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        const T v = static_cast<T>(d);
+
+        for (const chars_format fmt : {chars_format::general, chars_format::scientific, chars_format::hex})
+        {
+            char buffer[128];
+            const auto w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), v, fmt);
+            BOOST_TEST(w);
+
+            check<UC, T>(widen<UC>(std::string(buffer, w.ptr)), fmt);
+        }
+
+        char buffer[64];
+        const auto w = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), static_cast<long long>(bits));
+        check<UC, long long>(widen<UC>(std::string(buffer, w.ptr)), 10);
+    }
+}
+
+template <typename UC>
+void test_all()
+{
+    test_integer<UC, int>();
+    test_integer<UC, unsigned>();
+    test_integer<UC, long long>();
+    test_integer<UC, unsigned long long>();
+    test_integer<UC, signed char>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_integer<UC, boost::int128_type>();
+    test_integer<UC, boost::uint128_type>();
+    #endif
+
+    test_float<UC, float>();
+    test_float<UC, double>();
+    test_float<UC, long double>();
+
+    test_eight_digits<UC>();
+
+    test_random<UC, float>();
+    test_random<UC, double>();
+    test_random<UC, long double>();
+}
+
+int main()
+{
+    test_all<char16_t>();
+    test_all<char32_t>();
+    test_all<wchar_t>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,213 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+
+static const char* path = "load_numbers_test_input.txt";
+
+static void write_file(const std::string& text)
+{
+    std::FILE* file = std::fopen(path, "wb");
+    BOOST_TEST(file != nullptr);
+    BOOST_TEST_EQ(std::fwrite(text.data(), 1, text.size(), file), text.size());
+    std::fclose(file);
+}
+
+template <typename T>
+std::vector<T> serial_values(const std::string& text, char delimiter)
+{
+    std::vector<T> values;
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+
+    while (first != last)
+    {
+        T value;
+        const auto r = boost::charconv::from_chars(first, last, value);
+        BOOST_TEST(r);
+        BOOST_TEST(r.ptr == last || *r.ptr == delimiter);
+        values.push_back(value);
+        first = r.ptr == last ? last : r.ptr + 1;
+    }
+
+    return values;
+}
+
+// Files that end at every position relative to a page boundary, so that the
+// padding comes from the rest of the last page or from the extra mapping
+template <typename T>
+void test_sizes()
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<T> dist(-1e5, 1e5);
+
+    std::string text;
+
+    while (text.size() < 3 * 4096)
+    {
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), dist(rng));
+        text.append(buffer, r.ptr);
+        text += '\n';
+    }
+
+    for (std::size_t size = 4096 - 24; size <= 4096 + 24; ++size)
+    {
+        // Cut at a delimiter at or before size, and pad the last field with zeros to size
+        std::string file_text = text.substr(0, size);
+        const std::size_t cut = file_text.rfind('\n', size - 4);
+        file_text.resize(cut + 1);
+        file_text += '1';
+        file_text.resize(size, '0');
+
+        write_file(file_text);
+
+        const std::vector<T> expected = serial_values<T>(file_text, '\n');
+        std::vector<T> values;
+        const auto r = boost::charconv::load_numbers(path, '\n', values);
+
+        if (!BOOST_TEST(r) || !BOOST_TEST_EQ(r.count, expected.size()) || !BOOST_TEST_EQ(r.offset, size) ||
+            !BOOST_TEST(values == expected))
+        {
+            std::cerr << "Size: " << size << std::endl;
+        }
+    }
+}
+
+void test_delimiters()
+{
+    write_file("1.5,-2,3e10,inf,");
+
+    std::vector<double> values {42};
+    auto r = boost::charconv::load_numbers(path, ',', values);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 4U);
+    BOOST_TEST_EQ(r.offset, 16U);
+    BOOST_TEST_EQ(values.size(), 5U);
+    BOOST_TEST_EQ(values[0], 42);
+    BOOST_TEST_EQ(values[1], 1.5);
+    BOOST_TEST_EQ(values[3], 3e10);
+
+    float buffer[8] {};
+    r = boost::charconv::load_numbers(path, ',', buffer, buffer + 8);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 4U);
+    BOOST_TEST_EQ(buffer[1], -2.0F);
+
+    // The format is passed on to from_chars
+    const char* hex = "1.8p1";
+    double expected {};
+    BOOST_TEST(boost::charconv::from_chars(hex, hex + 5, expected, boost::charconv::chars_format::hex));
+
+    write_file("1.8p1 1.8p1");
+    values.clear();
+    r = boost::charconv::load_numbers(path, ' ', values, boost::charconv::chars_format::hex);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(values.size(), 2U);
+    BOOST_TEST_EQ(values[1], expected);
+
+    // Lines may end with \r\n
+    write_file("1.5\r\n-2\r\n3\r\n");
+    values.clear();
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 3U);
+    BOOST_TEST_EQ(r.offset, 12U);
+    BOOST_TEST(values == std::vector<double>({1.5, -2, 3}));
+
+    // Empty records at the end of the file are separators, not fields
+    write_file("1\n2\r\n\n\r\n\n");
+    values.clear();
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 2U);
+    BOOST_TEST_EQ(r.offset, 9U);
+    BOOST_TEST(values == std::vector<double>({1, 2}));
+
+    write_file("1,2,,,");
+    values.clear();
+    r = boost::charconv::load_numbers(path, ',', values);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 2U);
+}
+
+void test_errors()
+{
+    write_file("1\n2\n3x\n4\n");
+
+    std::vector<double> values;
+    auto r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 2U);
+    BOOST_TEST_EQ(r.offset, 4U);
+    BOOST_TEST_EQ(values.size(), 2U);
+
+    write_file("1\n\n2");
+    values.clear();
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 1U);
+    BOOST_TEST_EQ(r.offset, 2U);
+
+    // A \r is only part of a line ending before \n
+    write_file("1\r2\n");
+    values.clear();
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 0U);
+
+    write_file("1\r\n\r\n2\r\n");
+    values.clear();
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.count, 1U);
+    BOOST_TEST_EQ(r.offset, 3U);
+
+    write_file("1\n1e999\n");
+    values.clear();
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(r.count, 1U);
+
+    // More values than fit in the buffer
+    write_file("1\n2\n3\n4\n");
+    double buffer[3] {};
+    r = boost::charconv::load_numbers(path, '\n', buffer, buffer + 3);
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+    BOOST_TEST_EQ(r.count, 3U);
+    BOOST_TEST_EQ(r.offset, 6U);
+    BOOST_TEST_EQ(buffer[2], 3.0);
+
+    // An empty file has no values
+    write_file("");
+    values.clear();
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.count, 0U);
+    BOOST_TEST(values.empty());
+
+    std::remove(path);
+    r = boost::charconv::load_numbers(path, '\n', values);
+    BOOST_TEST(r.ec == std::errc::no_such_file_or_directory);
+    BOOST_TEST_EQ(r.count, 0U);
+}
+
+int main()
+{
+    test_sizes<float>();
+    test_sizes<double>();
+    test_delimiters();
+    test_errors();
+
+    std::remove(path);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,206 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+constexpr unsigned thread_counts[] = {0, 1, 2, 3, 8};
+
+// What a loop over from_chars does with the same input
+template <typename T>
+boost::charconv::from_chars_result serial_from_chars(const std::string& text, char delimiter, std::vector<T>& out)
+{
+    const char* first = text.data();
+    const char* last = text.data() + text.size();
+
+    while (first != last)
+    {
+        T value;
+        const auto r = boost::charconv::from_chars(first, last, value);
+
+        if (!r)
+        {
+            return r;
+        }
+
+        if (r.ptr != last && *r.ptr != delimiter)
+        {
+            return {r.ptr, std::errc::invalid_argument};
+        }
+
+        out.push_back(value);
+        first = r.ptr == last ? last : r.ptr + 1;
+    }
+
+    return {last, std::errc()};
+}
+
+template <typename T>
+void check(const std::string& text, char delimiter)
+{
+    std::vector<T> expected {T(42)};
+    const auto expected_r = serial_from_chars(text, delimiter, expected);
+
+    for (unsigned threads : thread_counts)
+    {
+        // Values are appended to what is already there
+        std::vector<T> values {T(42)};
+        const auto r = boost::charconv::parallel_from_chars(text.data(), text.data() + text.size(), delimiter, values, threads);
+
+        if (!BOOST_TEST_EQ(r.ptr - text.data(), expected_r.ptr - text.data()) ||
+            !BOOST_TEST(r.ec == expected_r.ec) ||
+            !BOOST_TEST_EQ(values.size(), expected.size()) ||
+            !BOOST_TEST(std::memcmp(values.data(), expected.data(), values.size() * sizeof(T)) == 0))
+        {
+            std::cerr << "Threads: " << threads << ", size: " << text.size() << std::endl;
+        }
+    }
+}
+
+// Large enough to be split into many chunks
+template <typename T>
+std::string random_text(std::size_t count, char delimiter, bool trailing)
+{
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<T> dist(-1e6, 1e6);
+
+    std::string text;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        char buffer[64];
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), i % 7 == 0 ? static_cast<T>(i) : dist(rng));
+        text.append(buffer, r.ptr);
+
+        if (trailing || i + 1 != count)
+        {
+            text += delimiter;
+        }
+    }
+
+    return text;
+}
+
+template <typename T>
+void test_valid()
+{
+    for (const char delimiter : {'\n', ',', ' ', ';'})
+    {
+        check<T>(random_text<T>(200000, delimiter, false), delimiter);
+        check<T>(random_text<T>(200000, delimiter, true), delimiter);
+        check<T>(random_text<T>(100, delimiter, false), delimiter);
+    }
+
+    check<T>("", ',');
+    check<T>("1", ',');
+    check<T>("1,", ',');
+    check<T>("-inf,nan,1e-5,0x", ',');
+}
+
+// Every error must be reported at the first field that fails, wherever the chunks were cut
+template <typename T>
+void test_errors()
+{
+    const std::string text = random_text<T>(200000, '\n', true);
+
+    std::mt19937_64 rng(7);
+
+    for (const char* bad : {"abc", "1.5x", "", "1e999", "--1", " 2"})
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            std::string copy = text;
+
+            // The start of a random field, including the first and the last
+            std::size_t pos = i == 0 ? 0 : i == 1 ? copy.size() : static_cast<std::size_t>(rng() % copy.size());
+            while (pos != 0 && copy[pos - 1] != '\n')
+            {
+                --pos;
+            }
+
+            copy.insert(pos, std::string(bad) + '\n');
+            check<T>(copy, '\n');
+
+            // A second error further on must not be reported
+            copy.insert(copy.size() - 10, "zzz");
+            check<T>(copy, '\n');
+        }
+    }
+}
+
+void test_delimiters()
+{
+    const std::string text = "1e5e2";
+
+    for (const char delimiter : {'e', '5', '.', '-', '+', 'n', '_'})
+    {
+        std::vector<double> values;
+        const auto r = boost::charconv::parallel_from_chars(text.data(), text.data() + text.size(), delimiter, values);
+        BOOST_TEST(r.ptr == text.data());
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+        BOOST_TEST(values.empty());
+    }
+
+    std::vector<double> values;
+    const auto r = boost::charconv::parallel_from_chars(boost::core::string_view("1|2.5|-3"), '|', values, 2);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(values.size(), 3U);
+}
+
+// Calls from several threads at once share the worker threads
+void test_concurrent_calls()
+{
+    const std::string text = random_text<double>(200000, ',', false);
+    std::vector<double> expected;
+    BOOST_TEST(serial_from_chars(text, ',', expected));
+
+    bool same[4] {};
+    std::vector<std::thread> callers;
+
+    for (bool& result : same)
+    {
+        callers.emplace_back([&]
+        {
+            result = true;
+
+            for (int i = 0; i < 4; ++i)
+            {
+                std::vector<double> values;
+                const auto r = boost::charconv::parallel_from_chars(text.data(), text.data() + text.size(), ',', values, 4);
+                result = result && r && values == expected;
+            }
+        });
+    }
+
+    for (auto& caller : callers)
+    {
+        caller.join();
+    }
+
+    for (const bool result : same)
+    {
+        BOOST_TEST(result);
+    }
+}
+
+int main()
+{
+    test_valid<float>();
+    test_valid<double>();
+
+    test_errors<double>();
+    test_errors<float>();
+
+    test_delimiters();
+    test_concurrent_calls();
+
+    return boost::report_errors();
+}
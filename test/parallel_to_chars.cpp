@@ -0,0 +1,147 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+constexpr unsigned thread_counts[] = {0, 1, 2, 3, 8};
+
+// What a loop over to_chars writes, precision -2 for the overload without it
+template <typename T>
+std::string serial_to_chars(const std::vector<T>& values, char delimiter, boost::charconv::chars_format fmt, int precision)
+{
+    std::string text;
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        if (i != 0)
+        {
+            text += delimiter;
+        }
+
+        char buffer[1100];
+        const auto r = precision == -2 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), values[i], fmt) :
+                                         boost::charconv::to_chars(buffer, buffer + sizeof(buffer), values[i], fmt, precision);
+        BOOST_TEST(r);
+        text.append(buffer, r.ptr);
+    }
+
+    return text;
+}
+
+template <typename T>
+void check(const std::vector<T>& values, char delimiter, boost::charconv::chars_format fmt, int precision)
+{
+    const std::string expected = serial_to_chars(values, delimiter, fmt, precision);
+
+    for (unsigned threads : thread_counts)
+    {
+        std::vector<char> buffer(expected.size() + 16, '#');
+        const T* values_first = values.data();
+        const T* values_last = values.data() + values.size();
+
+        const auto r = precision == -2 ?
+            boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + buffer.size(), values_first, values_last, delimiter, threads, fmt) :
+            boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + buffer.size(), values_first, values_last, delimiter, threads, fmt, precision);
+
+        if (!BOOST_TEST(r) ||
+            !BOOST_TEST_EQ(static_cast<std::size_t>(r.ptr - buffer.data()), expected.size()) ||
+            !BOOST_TEST(std::memcmp(buffer.data(), expected.data(), expected.size()) == 0) ||
+            !BOOST_TEST_EQ(buffer[expected.size()], '#'))
+        {
+            std::cerr << "Threads: " << threads << ", values: " << values.size()
+                      << ", format: " << static_cast<int>(fmt) << ", precision: " << precision << std::endl;
+        }
+
+        // One character short of the output
+        if (!expected.empty())
+        {
+            const auto short_r = precision == -2 ?
+                boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + expected.size() - 1, values_first, values_last, delimiter, threads, fmt) :
+                boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + expected.size() - 1, values_first, values_last, delimiter, threads, fmt, precision);
+
+            BOOST_TEST(short_r.ec == std::errc::value_too_large);
+            BOOST_TEST(short_r.ptr == buffer.data() + expected.size() - 1);
+        }
+    }
+}
+
+template <typename T>
+std::vector<T> random_values(std::size_t count)
+{
+    std::mt19937_64 rng(42);
+    std::vector<T> values;
+
+    while (values.size() < count)
+    {
+        const auto bits = rng();
+        T value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (std::isfinite(value))
+        {
+            values.push_back(value);
+        }
+    }
+
+    return values;
+}
+
+template <typename T>
+void test_formats()
+{
+    using boost::charconv::chars_format;
+
+    const auto values = random_values<T>(100000);
+
+    for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::hex})
+    {
+        check(values, '\n', fmt, -2);
+    }
+
+    check(values, ',', chars_format::scientific, 3);
+    check(values, ',', chars_format::general, 17);
+    check(values, ',', chars_format::hex, 5);
+
+    // Up to several hundred characters per value, more than the segments are sized for up front
+    const std::vector<T> fixed(values.begin(), values.begin() + 20000);
+    check(fixed, ' ', chars_format::fixed, -2);
+    check(fixed, ' ', chars_format::fixed, 2);
+
+    check(std::vector<T>(), '\n', chars_format::general, -2);
+    check(std::vector<T>(1, T(1)), '\n', chars_format::general, -2);
+    check(std::vector<T>(3, T(0.5)), '\n', chars_format::fixed, 1);
+}
+
+// The output reads back to the same values
+void test_roundtrip()
+{
+    const auto values = random_values<double>(200000);
+
+    std::vector<char> buffer(values.size() * (boost::charconv::limits<double>::max_chars + 1));
+    const auto r = boost::charconv::parallel_to_chars(buffer.data(), buffer.data() + buffer.size(), values.data(), values.data() + values.size(), '\n');
+    BOOST_TEST(r);
+
+    std::vector<double> roundtrip;
+    BOOST_TEST(boost::charconv::parallel_from_chars(buffer.data(), r.ptr, '\n', roundtrip));
+    BOOST_TEST(roundtrip == values);
+}
+
+int main()
+{
+    test_formats<float>();
+    test_formats<double>();
+
+    test_roundtrip();
+
+    return boost::report_errors();
+}
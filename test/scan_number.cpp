@@ -0,0 +1,111 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::number_kind;
+using boost::charconv::chars_format;
+
+void test(const char* str, std::size_t extent, number_kind kind, bool negative, std::size_t digits, std::int64_t exponent,
+          chars_format fmt = chars_format::general)
+{
+    const auto r = boost::charconv::scan_number(str, str + std::strlen(str), fmt);
+    if (!(BOOST_TEST(r) && BOOST_TEST_EQ(r.ptr, str + extent) && BOOST_TEST(r.kind == kind) &&
+          BOOST_TEST_EQ(r.negative, negative) && BOOST_TEST_EQ(r.digits, digits) && BOOST_TEST_EQ(r.exponent, exponent)))
+    {
+        std::cerr << "Failure for: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void test_error(const char* str, std::errc ec, chars_format fmt = chars_format::general)
+{
+    const auto r = boost::charconv::scan_number(str, str + std::strlen(str), fmt);
+    if (!(BOOST_TEST(r.ec == ec) && BOOST_TEST_EQ(r.ptr, str)))
+    {
+        std::cerr << "Failure for: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// The extent and validity of the scan must always agree with from_chars
+template <typename T>
+void test_matches_from_chars(const std::string& str, chars_format fmt = chars_format::general)
+{
+    for (std::size_t len = 0; len <= str.size(); ++len)
+    {
+        T v {};
+        const auto r1 = boost::charconv::from_chars(str.data(), str.data() + len, v, fmt);
+        const auto r2 = boost::charconv::scan_number(str.data(), str.data() + len, fmt);
+
+        const bool parsed = r1.ec != std::errc::invalid_argument;
+        if (!(BOOST_TEST_EQ(parsed, static_cast<bool>(r2)) && BOOST_TEST_EQ(r1.ptr, r2.ptr)))
+        {
+            std::cerr << "Mismatch for: " << str.substr(0, len) << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+int main()
+{
+    test("0", 1, number_kind::integer, false, 0, 0);
+    test("42", 2, number_kind::integer, false, 2, 1);
+    test("-7,8", 2, number_kind::integer, true, 1, 0);
+    test("000120", 6, number_kind::integer, false, 3, 2);
+    test("1234567890123456789012345", 25, number_kind::integer, false, 25, 24);
+    test("1.5", 3, number_kind::floating, false, 2, 0);
+    test("2.", 2, number_kind::floating, false, 1, 0);
+    test(".25", 3, number_kind::floating, false, 2, -1);
+    test("1234.5", 6, number_kind::floating, false, 5, 3);
+    test("-0.00120", 8, number_kind::floating, true, 3, -3);
+    test("1e10", 4, number_kind::floating, false, 1, 10);
+    test("1e", 1, number_kind::integer, false, 1, 0);
+    test("9.99E-400xyz", 9, number_kind::floating, false, 3, -400);
+    test("0.000000000000000000000000000000123456789012345678901234567890", 62, number_kind::floating, false, 30, -31);
+    test("inf", 3, number_kind::infinity, false, 0, 0);
+    test("-Infinity", 9, number_kind::infinity, true, 0, 0);
+    test("nan(snan)", 9, number_kind::nan, false, 0, 0);
+    test("-NAN", 4, number_kind::nan, true, 0, 0);
+
+    test("12.5e3", 4, number_kind::floating, false, 3, 1, chars_format::fixed);
+    test("12e3", 4, number_kind::floating, false, 2, 4, chars_format::scientific);
+
+    test_error("", std::errc::invalid_argument);
+    test_error("+1", std::errc::invalid_argument);
+    test_error(" 1", std::errc::invalid_argument);
+    test_error("-", std::errc::invalid_argument);
+    test_error(".", std::errc::invalid_argument);
+    test_error("e5", std::errc::invalid_argument);
+    test_error("12", std::errc::invalid_argument, chars_format::scientific);
+    test_error("1.5p3", std::errc::not_supported, chars_format::hex);
+
+    const auto sv = boost::charconv::scan_number(boost::core::string_view("3.0e2,"));
+    BOOST_TEST(sv);
+    BOOST_TEST(sv.kind == number_kind::floating);
+    BOOST_TEST_EQ(sv.exponent, 2);
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1e10, 1e10);
+    for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed})
+    {
+        for (std::size_t i = 0; i < 256; ++i)
+        {
+            char buffer[256] {};
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), dist(rng), fmt);
+            BOOST_TEST(r);
+            test_matches_from_chars<double>(std::string(buffer, r.ptr), fmt);
+        }
+    }
+
+    test_matches_from_chars<double>("-1.7976931348623157e+308", chars_format::general);
+    test_matches_from_chars<double>("1e99999", chars_format::general);
+    test_matches_from_chars<double>("-infinity", chars_format::general);
+    test_matches_from_chars<double>("nan(ind)", chars_format::general);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,151 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <cstring>
+#include <cstdint>
+
+// The counters are only updated if the library was compiled with BOOST_CHARCONV_ENABLE_STATS,
+// so every test has to hold in both configurations
+
+static void parse(const char* str)
+{
+    double v {};
+    const auto r = boost::charconv::from_chars(str, str + std::strlen(str), v);
+    BOOST_TEST(r);
+}
+
+template <typename T>
+static void format(T value, boost::charconv::chars_format fmt = boost::charconv::chars_format::general, int precision = -1)
+{
+    char buffer[256];
+    const auto r = precision == -1 ? boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt) :
+                                     boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, fmt, precision);
+    BOOST_TEST(r);
+}
+
+static std::uint64_t total(const boost::charconv::path_stats& s)
+{
+    return s.clinger + s.eisel_lemire + s.bigint + s.strtod +
+           s.integer_shortcut + s.fixed + s.dragonbox + s.floff + s.ryu + s.printf;
+}
+
+static std::uint64_t total_ns(const boost::charconv::path_stats& s)
+{
+    return s.integer_shortcut_ns + s.fixed_ns + s.dragonbox_ns + s.floff_ns + s.ryu_ns + s.printf_ns;
+}
+
+static bool enabled()
+{
+    boost::charconv::reset_stats();
+    parse("1.5");
+    const bool is_enabled = boost::charconv::stats().clinger != 0;
+    boost::charconv::reset_stats();
+    return is_enabled;
+}
+
+void test_disabled()
+{
+    parse("1.5");
+    parse("1.7976931348623157e308");
+    format(1.5);
+    format(1e-5, boost::charconv::chars_format::scientific);
+    BOOST_TEST_EQ(total(boost::charconv::stats()), UINT64_C(0));
+    BOOST_TEST_EQ(total_ns(boost::charconv::stats()), UINT64_C(0));
+}
+
+void test_tiers()
+{
+    boost::charconv::reset_stats();
+    BOOST_TEST_EQ(total(boost::charconv::stats()), UINT64_C(0));
+
+    parse("1.5");
+    parse("-42");
+    BOOST_TEST_EQ(boost::charconv::stats().clinger, UINT64_C(2));
+
+    parse("1.7976931348623157e308");
+    parse("2.2250738585072014e-308");
+    BOOST_TEST_EQ(boost::charconv::stats().eisel_lemire, UINT64_C(2));
+
+    // Exactly halfway between two doubles with too many digits to decide without arbitrary precision
+    parse("9007199254740993.0000000000000000001");
+    BOOST_TEST_EQ(boost::charconv::stats().bigint, UINT64_C(1));
+
+    BOOST_TEST_EQ(total(boost::charconv::stats()), UINT64_C(5));
+
+    // Failed parses never reach a conversion tier
+    double v {};
+    const char* str = "x1.5";
+    BOOST_TEST(!boost::charconv::from_chars(str, str + std::strlen(str), v));
+    BOOST_TEST_EQ(total(boost::charconv::stats()), UINT64_C(5));
+
+    boost::charconv::reset_stats();
+    BOOST_TEST_EQ(total(boost::charconv::stats()), UINT64_C(0));
+}
+
+void test_to_chars_tiers()
+{
+    boost::charconv::reset_stats();
+
+    format(123.456);
+    format(-2.5F);
+    BOOST_TEST_EQ(boost::charconv::stats().fixed, UINT64_C(2));
+
+    format(1e17);
+    format(-123456789.0F);
+    BOOST_TEST_EQ(boost::charconv::stats().integer_shortcut, UINT64_C(2));
+
+    format(1e-5);
+    format(1e300);
+    format(1.5, boost::charconv::chars_format::scientific);
+    BOOST_TEST_EQ(boost::charconv::stats().dragonbox, UINT64_C(3));
+
+    format(1.5, boost::charconv::chars_format::general, 10);
+    format(1.5, boost::charconv::chars_format::fixed, 3);
+    format(1.5, boost::charconv::chars_format::scientific, 50);
+    BOOST_TEST_EQ(boost::charconv::stats().floff, UINT64_C(3));
+
+    // Hex is not one of the tiers
+    format(1.5, boost::charconv::chars_format::hex);
+
+    #if BOOST_CHARCONV_LDBL_BITS > 64
+    format(1.5L);
+    format(1.5L, boost::charconv::chars_format::fixed, 3);
+    BOOST_TEST_EQ(boost::charconv::stats().ryu, UINT64_C(2));
+    BOOST_TEST_EQ(total(boost::charconv::stats()), UINT64_C(12));
+    #else
+    BOOST_TEST_EQ(total(boost::charconv::stats()), UINT64_C(10));
+    #endif
+
+    BOOST_TEST_EQ(boost::charconv::stats().printf, UINT64_C(0));
+
+    #if BOOST_CHARCONV_LDBL_BITS == 80
+    // A value that ryu gives up on is counted, and timed, by printf alone
+    const auto ryu_ns = boost::charconv::stats().ryu_ns;
+    format(1e-30L, boost::charconv::chars_format::general, 5);
+    BOOST_TEST_EQ(boost::charconv::stats().ryu, UINT64_C(2));
+    BOOST_TEST_EQ(boost::charconv::stats().ryu_ns, ryu_ns);
+    BOOST_TEST_EQ(boost::charconv::stats().printf, UINT64_C(1));
+    #endif
+
+    boost::charconv::reset_stats();
+    BOOST_TEST_EQ(total_ns(boost::charconv::stats()), UINT64_C(0));
+}
+
+int main()
+{
+    if (enabled())
+    {
+        test_tiers();
+        test_to_chars_tiers();
+    }
+    else
+    {
+        test_disabled();
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,465 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <type_traits>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cmath>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+struct stream_outcome
+{
+    std::errc ec;
+    std::size_t end; // Offset one past the number in the whole input
+};
+
+// Feeds str in the pieces given by cuts and maps the result back to an offset into str
+template <typename T, typename... Args>
+stream_outcome parse_in_pieces(const std::string& str, const std::vector<std::size_t>& cuts, T& value, Args... args)
+{
+    boost::charconv::stream_parser<T> parser(args...);
+
+    std::size_t first = 0;
+    for (std::size_t i = 0; i <= cuts.size(); ++i)
+    {
+        const std::size_t last = i < cuts.size() ? cuts[i] : str.size();
+        const auto r = parser.feed(str.data() + first, str.data() + last, value);
+
+        if (r.ec != std::errc::resource_unavailable_try_again)
+        {
+            BOOST_TEST(!parser.pending());
+            return {r.ec, static_cast<std::size_t>(r.ptr - str.data()) - parser.leftover().size()};
+        }
+
+        BOOST_TEST_EQ(r.ptr, str.data() + last);
+        BOOST_TEST_EQ(parser.pending(), last != 0);
+        first = last;
+    }
+
+    const auto r = parser.finish(value);
+    BOOST_TEST(r.ptr == nullptr);
+    return {r.ec, str.size() - parser.leftover().size()};
+}
+
+template <typename T>
+bool same_value(T a, T b)
+{
+    return (a != a && b != b) || (a == b && std::signbit(a) == std::signbit(b));
+}
+
+bool same_value(long long a, long long b) { return a == b; }
+bool same_value(int a, int b) { return a == b; }
+bool same_value(unsigned a, unsigned b) { return a == b; }
+bool same_value(signed char a, signed char b) { return a == b; }
+bool same_value(std::uint64_t a, std::uint64_t b) { return a == b; }
+
+// Every split of str into two pieces, and one character at a time, gives the result of from_chars on all of str
+template <typename T, typename... Args>
+void test_splits(const std::string& str, Args... args)
+{
+    T expected {};
+    const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected, args...);
+
+    std::vector<std::vector<std::size_t>> splits;
+    for (std::size_t cut = 0; cut <= str.size(); ++cut)
+    {
+        splits.push_back({cut});
+    }
+
+    std::vector<std::size_t> single;
+    for (std::size_t cut = 1; cut < str.size(); ++cut)
+    {
+        single.push_back(cut);
+    }
+    splits.push_back(single);
+
+    for (const auto& cuts : splits)
+    {
+        T value {};
+        const auto s = parse_in_pieces(str, cuts, value, args...);
+
+        if (!BOOST_TEST(s.ec == r.ec))
+        {
+            std::cerr << "Input: " << str << " cut at " << cuts.front() << std::endl; // LCOV_EXCL_LINE
+            continue;                                                                 // LCOV_EXCL_LINE
+        }
+
+        if (r.ec == std::errc() || r.ec == std::errc::result_out_of_range)
+        {
+            if (!BOOST_TEST_EQ(s.end, static_cast<std::size_t>(r.ptr - str.data())) || !BOOST_TEST(same_value(value, r.ec == std::errc() ? expected : T {})))
+            {
+                std::cerr << "Input: " << str << " cut at " << cuts.front() << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+}
+
+const char* const float_inputs[] = {
+    "0", "-0", "1", "1.5", "-0.25", "007", "1.", ".5", "-.5", "0.000123", "123.456e7", "1e5", "1E-3", "1e+07",
+    "1e", "1e+", "1E-", "1ex", "1e+x", "3.e2", "12345678901234567890", "123456789012345678901234567890",
+    "0.00000000000000000000000000000000000001234567890123456789012345",
+    "9007199254740993", "2.2250738585072011e-308", "4.9e-324", "2.4703282292062327e-324", "1e400", "-1e400", "1e-400",
+    "inf", "-inf", "INF", "infinity", "-InFiNiTy", "infin", "infinit", "infx", "in", "i",
+    "nan", "-nan", "NaN", "nan()", "nan(abc_123)", "nan(ab", "nan(ab,c)", "nan(", "na", "n",
+    "", "-", ".", "-.", "+1", "x", "e5", "-e5", ".e5", "01", "-01", "00", "0.", "0.5", "-0.0e-0", "1.e5", "0e5"
+};
+
+const char* const suffixes[] = { "", ",", " 7", "e", "x" };
+
+template <typename T>
+void test_float_inputs()
+{
+    for (const auto fmt : {chars_format::general, chars_format::fixed, chars_format::scientific, chars_format::json})
+    {
+        for (const char* input : float_inputs)
+        {
+            for (const char* suffix : suffixes)
+            {
+                test_splits<T>(std::string(input) + suffix, fmt);
+            }
+        }
+    }
+}
+
+// The 80 and 128-bit from_chars has its own parser, which accepts a slightly different grammar
+// at the edges (e.g. it consumes the e of 1e), so only the values are compared
+void test_long_double()
+{
+    const char* const inputs[] = {
+        "0", "-0", "1.5", "-0.25e-3", "1e400", "1e-4000", "123456789012345678901234567890", "3.e2", ".5",
+        "0.00000000000000000000000000000000000001234567890123456789012345", "1.18973149535723176502e+4932"
+    };
+
+    for (const char* input : inputs)
+    {
+        const std::string str = std::string(input) + ",";
+
+        long double expected {};
+        const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size() - 1, expected);
+
+        for (std::size_t cut = 0; cut <= str.size(); ++cut)
+        {
+            long double value {};
+            const auto s = parse_in_pieces(str, {cut}, value);
+
+            if (!(BOOST_TEST(s.ec == r.ec) && BOOST_TEST_EQ(s.end, str.size() - 1) && BOOST_TEST(!r || same_value(value, expected))))
+            {
+                std::cerr << "Input: " << str << " cut at " << cut << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+
+    // The 80 and 128-bit from_chars makes nan(snan) a signaling NaN, which to_chars tells apart
+    for (const char* input : {"nan(snan),", "-nan(SNAN),", "nan(ind),"})
+    {
+        const std::string str = input;
+
+        long double expected {};
+        boost::charconv::from_chars(str.data(), str.data() + str.size(), expected);
+        char expected_chars[32];
+        const auto e = boost::charconv::to_chars(expected_chars, expected_chars + sizeof(expected_chars), expected);
+
+        for (std::size_t cut = 0; cut <= str.size(); ++cut)
+        {
+            long double value {};
+            const auto s = parse_in_pieces(str, {cut}, value);
+
+            char value_chars[32];
+            const auto v = boost::charconv::to_chars(value_chars, value_chars + sizeof(value_chars), value);
+
+            if (!(BOOST_TEST(s.ec == std::errc()) && BOOST_TEST_EQ(std::string(value_chars, v.ptr), std::string(expected_chars, e.ptr))))
+            {
+                std::cerr << "Input: " << str << " cut at " << cut << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+
+    boost::charconv::stream_parser<long double> parser;
+    long double value {};
+    const char* str = "-inf";
+    BOOST_TEST(parser.feed(str, str + 2, value).ec == std::errc::resource_unavailable_try_again);
+    BOOST_TEST(parser.feed(str + 2, str + 4, value).ec == std::errc::resource_unavailable_try_again);
+    BOOST_TEST(parser.finish(value));
+    BOOST_TEST(std::isinf(value) && value < 0);
+}
+
+// More digits than fit in the mantissa, close to halfway so that the big integer comparison decides
+void test_long_inputs()
+{
+    std::mt19937_64 rng(42);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        const auto digits = static_cast<std::size_t>(20 + rng() % 900);
+        std::string str = "9007199254740993";
+        while (str.size() < digits)
+        {
+            str += static_cast<char>('0' + rng() % (i % 2 == 0 ? 1 : 10));
+        }
+        str += i % 3 == 0 ? "1" : "0";
+
+        if (i % 4 == 1)
+        {
+            str.insert(5, ".");
+        }
+
+        // Only split a few places to keep the test fast
+        for (const std::size_t cut : {std::size_t(0), std::size_t(3), std::size_t(19), str.size() / 2, str.size() - 1})
+        {
+            double value {};
+            const auto s = parse_in_pieces(str + ",", {cut}, value);
+
+            double expected {};
+            const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), expected);
+
+            BOOST_TEST(s.ec == r.ec);
+            BOOST_TEST_EQ(s.end, str.size());
+            BOOST_TEST_EQ(value, expected);
+        }
+    }
+}
+
+void test_random_doubles()
+{
+    std::mt19937_64 rng(42);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        char buffer[128];
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::scientific, 1 + i % 30);
+        *r.ptr++ = ';';
+
+        const std::string str(buffer, r.ptr);
+        const std::size_t cut = 1 + static_cast<std::size_t>(rng() % (str.size() - 1));
+
+        double a {};
+        const auto s = parse_in_pieces(str, {cut}, a);
+
+        double b {};
+        const auto e = boost::charconv::from_chars(str.data(), str.data() + str.size(), b);
+
+        if (!(BOOST_TEST(s.ec == e.ec) && BOOST_TEST_EQ(s.end, static_cast<std::size_t>(e.ptr - str.data())) && BOOST_TEST(same_value(a, b))))
+        {
+            std::cerr << "Input: " << str << " cut at " << cut << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+const char* const integer_inputs[] = {
+    "0", "7", "-7", "007", "42", "-128", "127", "128", "-129", "255", "256", "2147483647", "2147483648", "-2147483648",
+    "-2147483649", "4294967295", "4294967296", "18446744073709551615", "18446744073709551616", "99999999999999999999999",
+    "ff", "-FF", "zz", "101", "+1", " 1", "-"
+};
+
+void test_integer_inputs()
+{
+    for (const char* input : integer_inputs)
+    {
+        for (const char* suffix : suffixes)
+        {
+            const std::string str = std::string(input) + suffix;
+
+            test_splits<int>(str);
+            test_splits<unsigned>(str);
+            test_splits<signed char>(str);
+            test_splits<long long>(str);
+            test_splits<std::uint64_t>(str);
+            test_splits<int>(str, 16);
+            test_splits<unsigned>(str, 2);
+            test_splits<long long>(str, 36);
+        }
+    }
+}
+
+static_assert(boost::charconv::detail::is_stream_integer<char>::value, "from_chars parses char as an integer");
+static_assert(!boost::charconv::detail::is_stream_integer<bool>::value, "no from_chars for bool");
+static_assert(!boost::charconv::detail::is_stream_integer<char16_t>::value, "no from_chars for char16_t values");
+static_assert(!boost::charconv::detail::is_stream_integer<wchar_t>::value, "no from_chars for wchar_t values");
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+
+template <typename T>
+void test_int128(const std::string& str, std::errc ec)
+{
+    T expected {};
+    boost::charconv::from_chars(str.data(), str.data() + str.size(), expected);
+
+    for (std::size_t cut = 0; cut <= str.size(); ++cut)
+    {
+        T value {};
+        const auto s = parse_in_pieces(str, {cut}, value);
+
+        if (!(BOOST_TEST(s.ec == ec) && BOOST_TEST_EQ(s.end, str.size() - 1) && BOOST_TEST(ec != std::errc() || value == expected)))
+        {
+            std::cerr << "Input: " << str << " cut at " << cut << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+void test_int128()
+{
+    test_int128<boost::int128_type>("-170141183460469231731687303715884105728,", std::errc());
+    test_int128<boost::int128_type>("170141183460469231731687303715884105727,", std::errc());
+    test_int128<boost::int128_type>("170141183460469231731687303715884105728,", std::errc::result_out_of_range);
+    test_int128<boost::uint128_type>("340282366920938463463374607431768211455,", std::errc());
+    test_int128<boost::uint128_type>("340282366920938463463374607431768211456,", std::errc::result_out_of_range);
+}
+
+#else
+
+void test_int128()
+{
+}
+
+#endif
+
+// Like from_chars, a number needs at least one digit
+void test_integer_without_digits()
+{
+    boost::charconv::stream_parser<int> parser;
+    int value = 42;
+
+    const char* str = "-x";
+    auto r = parser.feed(str, str + 2, value);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(r.ptr, str);
+    BOOST_TEST_EQ(value, 42);
+
+    r = parser.feed(str, str + 1, value);
+    BOOST_TEST(r.ec == std::errc::resource_unavailable_try_again);
+    r = parser.finish(value);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(value, 42);
+    BOOST_TEST(!parser.pending());
+}
+
+// Records split across a ring buffer that wrapped around in the middle of a number
+void test_chunked_records()
+{
+    const std::string records = "1.25,-3e-2,17,nan,1e,0.5,inf";
+    const std::vector<double> expected = {1.25, -3e-2, 17, 0, 1, 0.5, std::numeric_limits<double>::infinity()};
+
+    for (std::size_t cut = 0; cut <= records.size(); ++cut)
+    {
+        const boost::core::string_view chunks[] = {boost::core::string_view(records.data(), cut),
+                                                   boost::core::string_view(records.data() + cut, records.size() - cut)};
+
+        boost::charconv::stream_parser<double> parser;
+        std::vector<double> values;
+
+        for (const auto& chunk : chunks)
+        {
+            const char* first = chunk.data();
+            const char* last = chunk.data() + chunk.size();
+
+            while (first != last)
+            {
+                double value;
+                const auto r = parser.feed(first, last, value);
+
+                if (r.ec == std::errc::resource_unavailable_try_again)
+                {
+                    break;
+                }
+
+                BOOST_TEST(r);
+                values.push_back(value);
+
+                // Whatever follows the number, here the e of "1e", is skipped up to the comma
+                BOOST_TEST(parser.leftover().empty() || parser.leftover() == "e");
+                first = r.ptr;
+                while (first != last && *first != ',')
+                {
+                    ++first;
+                }
+                if (first != last)
+                {
+                    ++first;
+                }
+            }
+        }
+
+        double value;
+        BOOST_TEST(parser.finish(value));
+        values.push_back(value);
+
+        if (BOOST_TEST_EQ(values.size(), expected.size()))
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                BOOST_TEST(i == 3 ? values[i] != values[i] : values[i] == expected[i]);
+            }
+        }
+    }
+}
+
+// Numbers cut anywhere are still held to the grammar of JSON, not to the one of general
+void test_json()
+{
+    const char* const inputs[][2] = {{"0", "1,"}, {"in", "f,"}, {".", "5,"}, {"1.", ","}, {"1e", ","}, {"-0", "0,"}};
+
+    for (const auto& input : inputs)
+    {
+        boost::charconv::stream_parser<double> parser(chars_format::json);
+        double value = 42;
+
+        auto r = parser.feed(input[0], input[0] + std::strlen(input[0]), value);
+        if (r.ec == std::errc::resource_unavailable_try_again)
+        {
+            r = parser.feed(input[1], input[1] + std::strlen(input[1]), value);
+        }
+
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+        BOOST_TEST_EQ(value, 42);
+        BOOST_TEST(!parser.pending());
+    }
+
+    boost::charconv::stream_parser<double> parser(chars_format::json);
+    double value;
+    const char* str = "-0.5e-3,";
+    BOOST_TEST(parser.feed(str, str + 4, value).ec == std::errc::resource_unavailable_try_again);
+    BOOST_TEST(parser.feed(str + 4, str + 8, value));
+    BOOST_TEST_EQ(value, -0.5e-3);
+}
+
+void test_hex()
+{
+    boost::charconv::stream_parser<double> parser(chars_format::hex);
+    double value;
+    const char* str = "1.8p1";
+
+    BOOST_TEST(parser.feed(str, str + 5, value).ec == std::errc::not_supported);
+    BOOST_TEST(parser.finish(value).ec == std::errc::not_supported);
+}
+
+int main()
+{
+    test_float_inputs<double>();
+    test_float_inputs<float>();
+    test_long_double();
+    test_long_inputs();
+    test_random_doubles();
+
+    test_integer_inputs();
+    test_integer_without_digits();
+    test_int128();
+
+    test_chunked_records();
+    test_json();
+    test_hex();
+
+    return boost::report_errors();
+}
@@ -263,6 +263,10 @@ void test_sprintf_float( T value, boost::charconv::chars_format fmt = boost::cha
             sprintf_fmt = fmt_from_type_hex(value);
             error_format = "Hex";
             break;
+        case boost::charconv::chars_format::json:
+            sprintf_fmt = fmt_from_type(value);
+            error_format = "JSON";
+            break;
     }
 
     print( value, buffer2, sizeof(buffer2), sprintf_fmt );
@@ -81,6 +81,19 @@ void test_128bit_int()
         auto r12 = boost::charconv::from_chars(buffer11, buffer11 + std::strlen(buffer11), v11);
         BOOST_TEST(r12.ec == std::errc());
         BOOST_TEST(v10 == v11);
+
+        // Small negative values use the 64-bit path with the magnitude
+        char buffer12[64] {};
+        T v12 = -5;
+        auto r13 = boost::charconv::to_chars(buffer12, buffer12 + sizeof(buffer12) - 1, v12);
+        BOOST_TEST(r13.ec == std::errc());
+        BOOST_TEST_CSTR_EQ(buffer12, "-5");
+
+        char buffer13[64] {};
+        T v13 = -static_cast<T>(UINT64_C(12345678901234567890));
+        auto r14 = boost::charconv::to_chars(buffer13, buffer13 + sizeof(buffer13) - 1, v13);
+        BOOST_TEST(r14.ec == std::errc());
+        BOOST_TEST_CSTR_EQ(buffer13, "-12345678901234567890");
     }
 }
 #endif
@@ -235,6 +248,35 @@ void negative_vals_test()
     BOOST_TEST_CSTR_EQ(buffer1, "-4321");
 }
 
+// The sign counts towards the size of the buffer, and nothing is written past last
+template <typename T>
+void negative_overflow_test()
+{
+    char buffer1[4] {'*', '*', '*', '*'};
+    T v1 = -123;
+    auto r1 = boost::charconv::to_chars(buffer1, buffer1 + 3, v1);
+    BOOST_TEST(r1.ec == std::errc::value_too_large);
+    BOOST_TEST(r1.ptr == buffer1 + 3);
+    BOOST_TEST_EQ(buffer1[3], '*');
+
+    auto r2 = boost::charconv::to_chars(buffer1, buffer1 + 4, v1);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST(r2.ptr == buffer1 + 4);
+
+    // Empty range in the generic base impl
+    char buffer2[1] {'*'};
+    T v2 = -1;
+    auto r3 = boost::charconv::to_chars(buffer2, buffer2, v2, 16);
+    BOOST_TEST(r3.ec == std::errc::value_too_large);
+    BOOST_TEST(r3.ptr == buffer2);
+    BOOST_TEST_EQ(buffer2[0], '*');
+
+    T v3 = 0;
+    auto r4 = boost::charconv::to_chars(buffer2, buffer2, v3, 16);
+    BOOST_TEST(r4.ec == std::errc::value_too_large);
+    BOOST_TEST_EQ(buffer2[0], '*');
+}
+
 template <typename T>
 void simple_test()
 {
@@ -283,6 +325,9 @@ int main()
     negative_vals_test<int>();
     negative_vals_test<long>();
 
+    negative_overflow_test<int>();
+    negative_overflow_test<long long>();
+
     sixty_four_bit_tests<long long>();
     sixty_four_bit_tests<std::uint64_t>();
 
@@ -107,6 +107,161 @@ void fixed_values()
     BOOST_TEST_CSTR_EQ(buffer1, "61851632");
 }
 
+// Precision 0 printed a '0' into the character before first when the integer part has more than two digits
+template <typename T>
+void fixed_precision_zero()
+{
+    char buffer1[256] {};
+    T v1 = -3290.25;
+    auto r1 = boost::charconv::to_chars(buffer1 + 1, buffer1 + sizeof(buffer1), v1, boost::charconv::chars_format::fixed, 0);
+    BOOST_TEST(r1.ec == std::errc());
+    BOOST_TEST_EQ(buffer1[0], '\0');
+    BOOST_TEST_CSTR_EQ(buffer1 + 1, "-3290");
+
+    char buffer2[256] {};
+    T v2 = 1e5;
+    auto r2 = boost::charconv::to_chars(buffer2 + 1, buffer2 + sizeof(buffer2), v2, boost::charconv::chars_format::fixed, 0);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST_EQ(buffer2[0], '\0');
+    BOOST_TEST_CSTR_EQ(buffer2 + 1, "100000");
+}
+
+// The decimal point was inserted one character past last when the digits and the sign filled the buffer
+template <typename T>
+void fixed_decimal_point_overflow()
+{
+    char buffer[32];
+    std::memset(buffer, '*', sizeof(buffer));
+    T v = -6381.4000000000005;
+    auto r1 = boost::charconv::to_chars(buffer, buffer + 17, v, boost::charconv::chars_format::fixed);
+    BOOST_TEST(r1.ec == std::errc::value_too_large);
+    BOOST_TEST(r1.ptr == buffer + 17);
+    BOOST_TEST_EQ(buffer[17], '*');
+
+    auto r2 = boost::charconv::to_chars(buffer, buffer + 18, v, boost::charconv::chars_format::fixed);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST(r2.ptr == buffer + 18);
+    BOOST_TEST_EQ(buffer[18], '*');
+    BOOST_TEST(std::memcmp(buffer, "-6381.400000000001", 18) == 0);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128
+
+// Ryu fixed padded the fraction over its own digits, printed a '.' with precision 0,
+// and checked the length without the sign
+void long_double_fixed_precision()
+{
+    char buffer1[64] {};
+    auto r1 = boost::charconv::to_chars(buffer1, buffer1 + sizeof(buffer1) - 1, 1e20L, boost::charconv::chars_format::fixed, 0);
+    BOOST_TEST(r1.ec == std::errc());
+    BOOST_TEST_CSTR_EQ(buffer1, "100000000000000000000");
+
+    char buffer2[64] {};
+    auto r2 = boost::charconv::to_chars(buffer2, buffer2 + sizeof(buffer2) - 1, 1.25L, boost::charconv::chars_format::fixed, 3);
+    BOOST_TEST(r2.ec == std::errc());
+    BOOST_TEST_CSTR_EQ(buffer2, "1.250");
+
+    char buffer3[64] {};
+    auto r3 = boost::charconv::to_chars(buffer3, buffer3 + sizeof(buffer3) - 1, 123.25L, boost::charconv::chars_format::fixed, 5);
+    BOOST_TEST(r3.ec == std::errc());
+    BOOST_TEST_CSTR_EQ(buffer3, "123.25000");
+
+    // "-100000000000000000000.00" is 25 characters
+    char buffer4[32];
+    std::memset(buffer4, '*', sizeof(buffer4));
+    auto r4 = boost::charconv::to_chars(buffer4, buffer4 + 24, -1e20L, boost::charconv::chars_format::fixed, 2);
+    BOOST_TEST(r4.ec == std::errc::value_too_large);
+    BOOST_TEST(r4.ptr == buffer4 + 24);
+    BOOST_TEST_EQ(buffer4[24], '*');
+
+    auto r5 = boost::charconv::to_chars(buffer4, buffer4 + 25, -1e20L, boost::charconv::chars_format::fixed, 2);
+    BOOST_TEST(r5.ec == std::errc());
+    BOOST_TEST(r5.ptr == buffer4 + 25);
+    BOOST_TEST_EQ(buffer4[25], '*');
+    BOOST_TEST(std::memcmp(buffer4, "-100000000000000000000.00", 25) == 0);
+}
+
+// General notation with a precision took the fixed path of ryu, which padded the
+// fraction with zeros and did not round to the number of significant digits
+void long_double_general_precision()
+{
+    const long double values[] = {1.5L, -1.2345L, 123.25L, 0.125L, 100.5L, 12345678.0L};
+    const int precisions[] = {1, 3, 6, 10};
+
+    for (const auto v : values)
+    {
+        for (const auto precision : precisions)
+        {
+            char buffer[64] {};
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer) - 1, v, boost::charconv::chars_format::general, precision);
+            BOOST_TEST(r.ec == std::errc());
+
+            char printf_buffer[64] {};
+            std::snprintf(printf_buffer, sizeof(printf_buffer), "%.*Lg", precision, v);
+            BOOST_TEST_CSTR_EQ(buffer, printf_buffer);
+        }
+    }
+}
+
+#endif
+
+// Every buffer size up to 31, which is shorter than the longest shortest output of the type
+template <typename T>
+void short_buffer(T v, const char* str, boost::charconv::chars_format fmt)
+{
+    const auto len = static_cast<std::ptrdiff_t>(std::strlen(str));
+
+    for (std::ptrdiff_t size = 0; size < 32; ++size)
+    {
+        char buffer[64];
+        std::memset(buffer, '*', sizeof(buffer));
+        const auto r = boost::charconv::to_chars(buffer, buffer + size, v, fmt);
+
+        if (size < len)
+        {
+            BOOST_TEST(r.ec == std::errc::value_too_large);
+            BOOST_TEST(r.ptr == buffer + size);
+        }
+        else
+        {
+            BOOST_TEST(r.ec == std::errc());
+            BOOST_TEST(r.ptr == buffer + len);
+            BOOST_TEST(std::memcmp(buffer, str, static_cast<std::size_t>(len)) == 0);
+        }
+
+        BOOST_TEST_EQ(buffer[size], '*');
+    }
+}
+
+// Zeros and the special values of ryu were written without checking the buffer
+void zero_and_special_short_buffer()
+{
+    short_buffer(-0.0, "-0", boost::charconv::chars_format::general);
+    short_buffer(-0.0F, "-0", boost::charconv::chars_format::fixed);
+    short_buffer(-0.0, "-0e+00", boost::charconv::chars_format::scientific);
+    short_buffer(0.0, "0p+0", boost::charconv::chars_format::hex);
+    short_buffer(-0.0, "-0p+0", boost::charconv::chars_format::hex);
+    short_buffer(-0.0F, "-0p+0", boost::charconv::chars_format::hex);
+
+    #if BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128
+    char buffer[8];
+    std::memset(buffer, '*', sizeof(buffer));
+    const auto v = -std::numeric_limits<long double>::infinity();
+    const auto r1 = boost::charconv::to_chars(buffer, buffer, v);
+    BOOST_TEST(r1.ec == std::errc::value_too_large);
+    BOOST_TEST_EQ(buffer[0], '*');
+
+    const auto r2 = boost::charconv::to_chars(buffer, buffer, v, boost::charconv::chars_format::scientific, 2);
+    BOOST_TEST(r2.ec == std::errc::value_too_large);
+    BOOST_TEST_EQ(buffer[0], '*');
+
+    const auto r3 = boost::charconv::to_chars(buffer, buffer + 4, v);
+    BOOST_TEST(r3.ec == std::errc());
+    BOOST_TEST(std::memcmp(buffer, "-inf", 4) == 0);
+    BOOST_TEST_EQ(buffer[4], '*');
+    #endif
+}
+
 template <typename T>
 void failing_ci_values()
 {
@@ -186,6 +341,27 @@ void test_printf_fallback(T v, const std::string&, boost::charconv::chars_format
     BOOST_TEST_CSTR_EQ(buffer, printf_buffer);
 }
 
+// snprintf truncates to fit the null terminator, which used to be returned as success
+template <typename T>
+void printf_fallback_truncation()
+{
+    char buffer[16];
+    std::memset(buffer, '*', sizeof(buffer));
+    const auto r1 = boost::charconv::detail::to_chars_printf_impl(buffer, buffer + 5, T(123456), boost::charconv::chars_format::fixed, 2);
+    BOOST_TEST(r1.ec == std::errc::value_too_large);
+    BOOST_TEST(r1.ptr == buffer + 5);
+    BOOST_TEST_EQ(buffer[5], '*');
+
+    // The null terminator does not fit either
+    const auto r2 = boost::charconv::detail::to_chars_printf_impl(buffer, buffer + 5, T(12345), boost::charconv::chars_format::fixed, 0);
+    BOOST_TEST(r2.ec == std::errc::value_too_large);
+
+    const auto r3 = boost::charconv::detail::to_chars_printf_impl(buffer, buffer + 6, T(12345), boost::charconv::chars_format::fixed, 0);
+    BOOST_TEST(r3.ec == std::errc());
+    BOOST_TEST(r3.ptr == buffer + 5);
+    BOOST_TEST(std::memcmp(buffer, "12345", 5) == 0);
+}
+
 std::string format(int prec)
 {
     std::string format = "%." + std::to_string(prec) + "g";
@@ -235,6 +411,24 @@ int main()
     fixed_values<float>();
     fixed_values<double>();
 
+    fixed_precision_zero<float>();
+    fixed_precision_zero<double>();
+    fixed_decimal_point_overflow<double>();
+
+    #if BOOST_CHARCONV_LDBL_BITS == 80 || BOOST_CHARCONV_LDBL_BITS == 128
+    long_double_fixed_precision();
+    long_double_general_precision();
+    #endif
+
+    short_buffer(1e-5, "1e-05", boost::charconv::chars_format::scientific);
+    short_buffer(-1.2345678901234567e-300, "-1.2345678901234568e-300", boost::charconv::chars_format::general);
+    short_buffer(3e10F, "3e+10", boost::charconv::chars_format::scientific);
+    short_buffer(-1.5e-30F, "-1.5e-30", boost::charconv::chars_format::scientific);
+    zero_and_special_short_buffer();
+
+    printf_fallback_truncation<double>();
+    printf_fallback_truncation<long double>();
+
     failing_ci_values<double>();
 
     // Values from ryu tests
@@ -0,0 +1,151 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <limits>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+using boost::charconv::json_nonfinite;
+using boost::charconv::json_options;
+
+template <typename T>
+std::string json_of(T value, const json_options& options = json_options())
+{
+    char buffer[128];
+    const auto r = boost::charconv::to_chars_json(buffer, buffer + sizeof(buffer), value, options);
+    BOOST_TEST(r);
+    return std::string(buffer, r ? r.ptr : buffer);
+}
+
+template <typename T>
+void test_nonfinite()
+{
+    const T values[] = {std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                        std::numeric_limits<T>::quiet_NaN(), -std::numeric_limits<T>::quiet_NaN()};
+
+    json_options null_options;
+    null_options.nonfinite = json_nonfinite::null;
+
+    for (const T value : values)
+    {
+        char buffer[64];
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::json);
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, chars_format::json, 3);
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+        r = boost::charconv::to_chars_json(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+        BOOST_TEST_EQ(json_of(value, null_options), "null");
+
+        r = boost::charconv::to_chars_json(buffer, buffer + 3, value, null_options);
+        BOOST_TEST(r.ec == std::errc::value_too_large);
+    }
+}
+
+void test_integer_fraction()
+{
+    json_options options;
+    options.integer_fraction = true;
+
+    BOOST_TEST_EQ(json_of(3.0, options), "3.0");
+    BOOST_TEST_EQ(json_of(-0.0, options), "-0.0");
+    BOOST_TEST_EQ(json_of(0.0, options), "0.0");
+    BOOST_TEST_EQ(json_of(1.5, options), "1.5");
+    BOOST_TEST_EQ(json_of(1e17, options), "100000000000000000.0");
+    BOOST_TEST_EQ(json_of(1e20, options), "1e+20");
+    BOOST_TEST_EQ(json_of(1e-7, options), "1e-07");
+    BOOST_TEST_EQ(json_of(12345.0F, options), "12345.0");
+    BOOST_TEST_EQ(json_of(3.0L, options), "3.0");
+
+    BOOST_TEST_EQ(json_of(3.0), "3");
+
+    char buffer[4];
+    BOOST_TEST(boost::charconv::to_chars_json(buffer, buffer + sizeof(buffer), 123.0, options).ec == std::errc::value_too_large);
+}
+
+// Finite values are written as general and read back by chars_format::json as by general,
+// and the integer fraction is added exactly where the text has neither a fraction nor an exponent
+template <typename T>
+void test_random()
+{
+    std::mt19937_64 rng(42);
+
+    json_options options;
+    options.integer_fraction = true;
+
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        T value;
+
+        if (i % 2 == 0)
+        {
+            const auto bits = rng();
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            value = static_cast<T>(d);
+        }
+        else
+        {
+            // Integer values around the limits of the integer paths
+            value = static_cast<T>(std::ldexp(static_cast<double>(rng() >> 11), static_cast<int>(rng() % 40)));
+        }
+
+        if (!(value == value) || std::isinf(value))
+        {
+            continue;
+        }
+
+        char general[128];
+        const auto r1 = boost::charconv::to_chars(general, general + sizeof(general), value);
+        BOOST_TEST(r1);
+        const std::string expected(general, r1.ptr);
+
+        char json[128];
+        const auto r2 = boost::charconv::to_chars(json, json + sizeof(json), value, chars_format::json);
+        BOOST_TEST(r2);
+        BOOST_TEST_EQ(std::string(json, r2.ptr), expected);
+
+        const std::string text = json_of(value, options);
+        const bool integer = expected.find_first_of(".eE") == std::string::npos;
+
+        if (!BOOST_TEST_EQ(text, integer ? expected + ".0" : expected))
+        {
+            continue;
+        }
+
+        T parsed {};
+        const auto r3 = boost::charconv::from_chars(text.data(), text.data() + text.size(), parsed, chars_format::json);
+        BOOST_TEST(r3);
+        BOOST_TEST(r3.ptr == text.data() + text.size());
+
+        T parsed_general {};
+        boost::charconv::from_chars(text.data(), text.data() + text.size(), parsed_general);
+        BOOST_TEST(parsed == parsed_general);
+    }
+}
+
+int main()
+{
+    test_nonfinite<float>();
+    test_nonfinite<double>();
+    test_nonfinite<long double>();
+
+    test_integer_fraction();
+
+    test_random<float>();
+    test_random<double>();
+    test_random<long double>();
+
+    return boost::report_errors();
+}
@@ -302,6 +302,9 @@ template<> void test_sprintf_float( long double value, boost::charconv::chars_fo
             case boost::charconv::chars_format::hex:
                 error_format = "Hex";
                 break;
+            case boost::charconv::chars_format::json:
+                error_format = "JSON";
+                break;
         }
 
         std::cerr << "Failure: " << static_cast<int>(r.ec)
@@ -0,0 +1,186 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::chars_format;
+
+// Writes value with the char and the UC overloads into buffers of the same size, and compares
+template <typename UC, typename T, typename... Args>
+void check(std::size_t size, T value, Args... args)
+{
+    // One code unit more that must not be written
+    std::vector<char> narrow(size + 1, '*');
+    const auto r1 = boost::charconv::to_chars(narrow.data(), narrow.data() + size, value, args...);
+    BOOST_TEST_EQ(narrow[size], '*');
+
+    std::vector<UC> wide(size + 1, static_cast<UC>(0x2A2A));
+    const auto r2 = boost::charconv::to_chars(wide.data(), wide.data() + size, value, args...);
+    BOOST_TEST(wide[size] == static_cast<UC>(0x2A2A));
+
+    if (!(BOOST_TEST(r2.ec == r1.ec) && BOOST_TEST_EQ(r2.ptr - wide.data(), r1.ptr - narrow.data())))
+    {
+        std::cerr << "Size: " << size << std::endl;
+        return;
+    }
+
+    if (r1)
+    {
+        const std::string expected(narrow.data(), r1.ptr);
+        std::string text;
+        for (const UC* p = wide.data(); p != r2.ptr; ++p)
+        {
+            text += static_cast<std::uint32_t>(*p) > 127U ? '?' : static_cast<char>(*p);
+        }
+
+        BOOST_TEST_EQ(text, expected);
+    }
+}
+
+template <typename UC, typename T>
+void test_integer()
+{
+    std::mt19937_64 rng(42);
+
+    const T values[] = {T(0), T(1), T(9), T(10), (std::numeric_limits<T>::max)(), (std::numeric_limits<T>::min)()};
+
+    for (const T value : values)
+    {
+        for (const int base : {2, 8, 10, 16, 36})
+        {
+            check<UC>(70, value, base);
+        }
+    }
+
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        const T value = static_cast<T>(rng() >> (i % 64));
+        check<UC>(70, value, 10);
+        check<UC>(70, value, static_cast<int>(2 + i % 35));
+
+        // Too small, exactly large enough, and larger buffers
+        char narrow[70];
+        const auto n = static_cast<std::size_t>(boost::charconv::to_chars(narrow, narrow + sizeof(narrow), value).ptr - narrow);
+        check<UC>(n - 1, value, 10);
+        check<UC>(n, value, 10);
+    }
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+template <typename UC>
+void test_int128()
+{
+    const boost::uint128_type big = (static_cast<boost::uint128_type>(UINT64_C(0x123456789ABCDEF0)) << 64) | UINT64_C(0xFEDCBA9876543210);
+
+    for (const int base : {2, 10, 16})
+    {
+        check<UC>(140, big, base);
+        check<UC>(140, -static_cast<boost::int128_type>(big >> 1), base);
+        check<UC>(140, static_cast<boost::uint128_type>(42), base);
+        check<UC>(140, static_cast<boost::int128_type>(-5), base);
+    }
+}
+#endif
+
+template <typename UC, typename T>
+void test_float()
+{
+    std::mt19937_64 rng(42);
+
+    const T specials[] = {T(0), -T(0), T(1), T(0.5), T(1e10), std::numeric_limits<T>::max(), std::numeric_limits<T>::min(),
+                          std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::infinity(),
+                          -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()};
+
+    for (const T value : specials)
+    {
+        for (const chars_format fmt : {chars_format::general, chars_format::fixed, chars_format::scientific, chars_format::hex})
+        {
+            check<UC>(64, value, fmt);
+            check<UC>(64, value, fmt, 10);
+        }
+    }
+
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        const auto bits = rng();
+        double d;
+        std::memcpy(&d, &bits, sizeof(d));
+        const T value = static_cast<T>(d);
+
+        for (const chars_format fmt : {chars_format::general, chars_format::scientific, chars_format::hex})
+        {
+            check<UC>(64, value, fmt);
+            check<UC>(64, value, fmt, static_cast<int>(i % 20));
+        }
+
+        // Buffers around the length of the output
+        char narrow[64];
+        const auto r = boost::charconv::to_chars(narrow, narrow + sizeof(narrow), value);
+        if (r)
+        {
+            const auto n = static_cast<std::size_t>(r.ptr - narrow);
+            check<UC>(n - 1, value);
+            check<UC>(n, value);
+        }
+    }
+
+    // Longer than the buffer on the stack
+    check<UC>(1000, T(1.5), chars_format::fixed, 600);
+    check<UC>(1000, T(1e30), chars_format::fixed, 300);
+    check<UC>(500, T(1.5), chars_format::fixed, 600);
+    check<UC>(10000, std::numeric_limits<T>::max(), chars_format::fixed, 0);
+    check<UC>(10000, std::numeric_limits<T>::max(), chars_format::fixed);
+    check<UC>(100, std::numeric_limits<T>::max(), chars_format::fixed);
+}
+
+// Fixed output around the size of the buffer on the stack that the value is formatted into
+template <typename UC>
+void test_stack_buffer()
+{
+    for (std::size_t size = 250; size < 262; ++size)
+    {
+        check<UC>(size, -1e254L, chars_format::fixed);
+        check<UC>(size, -1e255L, chars_format::fixed);
+        check<UC>(size, 1e255L, chars_format::fixed);
+        check<UC>(size, -1e254, chars_format::fixed);
+        check<UC>(size, -1e255, chars_format::fixed);
+    }
+}
+
+template <typename UC>
+void test_all()
+{
+    test_integer<UC, int>();
+    test_integer<UC, unsigned>();
+    test_integer<UC, long long>();
+    test_integer<UC, unsigned long long>();
+    test_integer<UC, short>();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_int128<UC>();
+    #endif
+
+    test_float<UC, float>();
+    test_float<UC, double>();
+    test_float<UC, long double>();
+
+    test_stack_buffer<UC>();
+}
+
+int main()
+{
+    test_all<char16_t>();
+    test_all<char32_t>();
+    test_all<wchar_t>();
+
+    return boost::report_errors();
+}